@@ -7,10 +7,12 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
 #include <compare>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <cwchar>
 #include <functional>
@@ -33,8 +35,924 @@
 #error "requires __cpp_size_t_suffix"
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define BIZWEN_BASIC_STRING_SSE2
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BIZWEN_BASIC_STRING_AVX2
+#define BIZWEN_BASIC_STRING_AVX2_TARGET
+#define BIZWEN_BASIC_STRING_KERNEL_INLINE
+#elif defined(BIZWEN_BASIC_STRING_SSE2) && (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__)) && !(defined(BIZWEN_SIMD_LEVEL) && BIZWEN_SIMD_LEVEL < 2)
+// the AVX2 kernels are compiled with the target attribute and selected at run time
+#include <cstdlib>
+#include <immintrin.h>
+#define BIZWEN_BASIC_STRING_AVX2
+#define BIZWEN_BASIC_STRING_AVX2_TARGET [[gnu::target("avx2")]]
+// the kernels are always inlined into the entries, so the AVX2 kernels are compiled only for AVX2 and no vector is
+// passed to or returned from a function which is not, even at -O0
+#define BIZWEN_BASIC_STRING_KERNEL_INLINE [[gnu::always_inline]]
+#define BIZWEN_BASIC_STRING_DISPATCH
+#else
+#define BIZWEN_BASIC_STRING_KERNEL_INLINE
+#endif
+
 namespace bizwen
 {
+/**
+ * @brief instruction sets of the kernels used by the runtime branches
+ */
+enum class simd_level : unsigned char
+{
+    scalar,
+    sse2,
+    avx2
+};
+
+namespace detail
+{
+// ********************************* begin simd ******************************
+
+// The kernels below are used by the runtime (if !consteval) branches, each kernel has a scalar loop for the
+// tail and for targets without SIMD. A kernel is a template of the vector type, void is scalar, and is called
+// through simd_kernels_table_, which selects the level at compile time, or at the first call if the AVX2 kernels
+// are compiled with the target attribute.
+
+#if defined(BIZWEN_BASIC_STRING_SSE2)
+/**
+ * @brief a 128-bit register holding 16 / sizeof(CharT) characters
+ * @brief comparisons set all bits of the lanes that satisfy them, and mask() returns sizeof(CharT) bits per lane
+ */
+template <typename CharT>
+struct sse2_vec_
+{
+    __m128i v;
+
+    static inline constexpr ::std::size_t size{16uz / sizeof(CharT)};
+    static inline constexpr ::std::uint32_t full_mask{0xffffu};
+
+    static sse2_vec_ load(CharT const *p) noexcept
+    {
+        return {_mm_loadu_si128(reinterpret_cast<__m128i const *>(p))};
+    }
+
+    static sse2_vec_ broadcast(CharT ch) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm_set1_epi8(static_cast<char>(ch))};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm_set1_epi16(static_cast<short>(ch))};
+        else
+            return {_mm_set1_epi32(static_cast<int>(ch))};
+    }
+
+    void store(CharT *p) const noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+    }
+
+    ::std::uint32_t mask() const noexcept
+    {
+        return static_cast<::std::uint32_t>(_mm_movemask_epi8(v));
+    }
+
+    friend sse2_vec_ operator==(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm_cmpeq_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm_cmpeq_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm_cmpeq_epi32(lhs.v, rhs.v)};
+    }
+
+    /**
+     * @brief unsigned comparison, the sign bits are flipped since SSE2 only compares signed integers
+     */
+    friend sse2_vec_ operator>(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        auto const sign = broadcast(static_cast<CharT>(CharT(1) << (sizeof(CharT) * 8uz - 1uz))).v;
+        auto const l = _mm_xor_si128(lhs.v, sign);
+        auto const r = _mm_xor_si128(rhs.v, sign);
+
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm_cmpgt_epi8(l, r)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm_cmpgt_epi16(l, r)};
+        else
+            return {_mm_cmpgt_epi32(l, r)};
+    }
+
+    friend sse2_vec_ operator<(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        return rhs > lhs;
+    }
+
+    friend sse2_vec_ operator|(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        return {_mm_or_si128(lhs.v, rhs.v)};
+    }
+
+    friend sse2_vec_ operator&(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        return {_mm_and_si128(lhs.v, rhs.v)};
+    }
+
+    friend sse2_vec_ operator^(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        return {_mm_xor_si128(lhs.v, rhs.v)};
+    }
+
+    friend sse2_vec_ operator+(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm_add_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm_add_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm_add_epi32(lhs.v, rhs.v)};
+    }
+
+    friend sse2_vec_ operator-(sse2_vec_ lhs, sse2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm_sub_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm_sub_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm_sub_epi32(lhs.v, rhs.v)};
+    }
+};
+#endif
+
+#if defined(BIZWEN_BASIC_STRING_AVX2)
+/**
+ * @brief a 256-bit register holding 32 / sizeof(CharT) characters, see sse2_vec_
+ */
+template <typename CharT>
+struct avx2_vec_
+{
+    __m256i v;
+
+    static inline constexpr ::std::size_t size{32uz / sizeof(CharT)};
+    static inline constexpr ::std::uint32_t full_mask{0xffffffffu};
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET static avx2_vec_ load(CharT const *p) noexcept
+    {
+        return {_mm256_loadu_si256(reinterpret_cast<__m256i const *>(p))};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET static avx2_vec_ broadcast(CharT ch) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm256_set1_epi8(static_cast<char>(ch))};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm256_set1_epi16(static_cast<short>(ch))};
+        else
+            return {_mm256_set1_epi32(static_cast<int>(ch))};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET void store(CharT *p) const noexcept
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET ::std::uint32_t mask() const noexcept
+    {
+        return static_cast<::std::uint32_t>(_mm256_movemask_epi8(v));
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator==(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm256_cmpeq_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm256_cmpeq_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm256_cmpeq_epi32(lhs.v, rhs.v)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator>(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        auto const sign = broadcast(static_cast<CharT>(CharT(1) << (sizeof(CharT) * 8uz - 1uz))).v;
+        auto const l = _mm256_xor_si256(lhs.v, sign);
+        auto const r = _mm256_xor_si256(rhs.v, sign);
+
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm256_cmpgt_epi8(l, r)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm256_cmpgt_epi16(l, r)};
+        else
+            return {_mm256_cmpgt_epi32(l, r)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator<(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        return rhs > lhs;
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator|(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        return {_mm256_or_si256(lhs.v, rhs.v)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator&(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        return {_mm256_and_si256(lhs.v, rhs.v)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator^(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        return {_mm256_xor_si256(lhs.v, rhs.v)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator+(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm256_add_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm256_add_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm256_add_epi32(lhs.v, rhs.v)};
+    }
+
+    BIZWEN_BASIC_STRING_AVX2_TARGET friend avx2_vec_ operator-(avx2_vec_ lhs, avx2_vec_ rhs) noexcept
+    {
+        if constexpr (sizeof(CharT) == 1uz)
+            return {_mm256_sub_epi8(lhs.v, rhs.v)};
+        else if constexpr (sizeof(CharT) == 2uz)
+            return {_mm256_sub_epi16(lhs.v, rhs.v)};
+        else
+            return {_mm256_sub_epi32(lhs.v, rhs.v)};
+    }
+};
+#endif
+
+// with BIZWEN_BASIC_STRING_DISPATCH, code outside the kernels uses the baseline
+#if defined(BIZWEN_BASIC_STRING_AVX2) && !defined(BIZWEN_BASIC_STRING_DISPATCH)
+template <typename CharT>
+using simd_vec_ = avx2_vec_<CharT>;
+#define BIZWEN_BASIC_STRING_SIMD
+#elif defined(BIZWEN_BASIC_STRING_SSE2)
+template <typename CharT>
+using simd_vec_ = sse2_vec_<CharT>;
+#define BIZWEN_BASIC_STRING_SIMD
+#endif
+
+/**
+ * @return index of the first lane set in a non-zero mask
+ */
+template <typename CharT>
+inline ::std::size_t first_lane_(::std::uint32_t mask) noexcept
+{
+    return static_cast<::std::size_t>(::std::countr_zero(mask)) / sizeof(CharT);
+}
+
+/**
+ * @return a pointer to the first character that is not ASCII, or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *ascii_prefix_kernel_(CharT const *first,
+                                                                           CharT const *last) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const ascii_max = vec::broadcast(CharT(0x7f));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            if (auto const mask = (vec::load(first) > ascii_max).mask())
+                return first + first_lane_<CharT>(mask);
+        }
+    }
+
+    for (; first != last && static_cast<::std::make_unsigned_t<CharT>>(*first) < 0x80u; ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @return a pointer to the first ch in [first, last), or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *find_char_kernel_(CharT const *first, CharT const *last,
+                                                                        CharT ch) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const needle = vec::broadcast(ch);
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            if (auto const mask = (vec::load(first) == needle).mask())
+                return first + first_lane_<CharT>(mask);
+        }
+    }
+
+    for (; first != last && *first != ch; ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @brief the vectorized loop compares every block with each character of the set, so it is limited to small sets
+ * @return a pointer to the first character in [first, last) that is in [set, set + set_size), or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *find_first_of_kernel_(CharT const *first, CharT const *last,
+                                                                            CharT const *set,
+                                                                            ::std::size_t set_size) noexcept
+{
+    if (set_size == 0uz)
+        return last;
+
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+
+        if (set_size <= 16uz)
+        {
+            vec chars[16];
+
+            for (auto i = 0uz; i != set_size; ++i)
+                chars[i] = vec::broadcast(set[i]);
+
+            for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+            {
+                auto const v = vec::load(first);
+                auto match = v == chars[0];
+
+                for (auto i = 1uz; i != set_size; ++i)
+                    match = match | (v == chars[i]);
+
+                if (auto const mask = match.mask())
+                    return first + first_lane_<CharT>(mask);
+            }
+        }
+    }
+
+    for (; first != last; ++first)
+    {
+        for (auto i = 0uz; i != set_size; ++i)
+        {
+            if (*first == set[i])
+                return first;
+        }
+    }
+
+    return last;
+}
+
+/**
+ * @brief candidates are the positions where both the first and the last character of the needle match, only they
+ * @brief are compared completely
+ * @return a pointer to the first occurrence of [needle, needle + size) in [first, last), or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *search_kernel_(CharT const *first, CharT const *last,
+                                                                     CharT const *needle, ::std::size_t size) noexcept
+{
+    if (size == 0uz)
+        return first;
+
+    if (size == 1uz)
+        return find_char_kernel_<Vec>(first, last, *needle);
+
+    if (static_cast<::std::size_t>(last - first) < size)
+        return last;
+
+    auto const tail = size - 1uz;
+    auto const bytes = size * sizeof(CharT);
+
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const front = vec::broadcast(needle[0]);
+        auto const back = vec::broadcast(needle[tail]);
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size + tail; first += vec::size)
+        {
+            auto mask = ((vec::load(first) == front) & (vec::load(first + tail) == back)).mask();
+
+            while (mask)
+            {
+                auto const i = first_lane_<CharT>(mask);
+
+                if (::std::memcmp(first + i, needle, bytes) == 0)
+                    return first + i;
+
+                // clear all bits of the lane
+                mask &= ~(((1u << sizeof(CharT)) - 1u) << (i * sizeof(CharT)));
+            }
+        }
+    }
+
+    for (auto const end = last - tail; first != end; ++first)
+    {
+        if (*first == *needle && ::std::memcmp(first, needle, bytes) == 0)
+            return first;
+    }
+
+    return last;
+}
+
+/**
+ * @brief whitespace is ' ', '\t', '\n', '\v', '\f' and '\r', as in the "C" locale
+ */
+template <typename CharT>
+inline constexpr bool is_space_(CharT ch) noexcept
+{
+    return ch == CharT(' ') || static_cast<::std::make_unsigned_t<CharT>>(ch - CharT('\t')) < 5u;
+}
+
+/**
+ * @return a pointer to the first character in [first, last) that is not whitespace, or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *skip_space_kernel_(CharT const *first, CharT const *last) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const space = vec::broadcast(CharT(' '));
+        auto const tab = vec::broadcast(CharT('\t'));
+        auto const controls = vec::broadcast(CharT(5));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            auto const v = vec::load(first);
+
+            if (auto const mask = ~((v == space) | ((v - tab) < controls)).mask() & vec::full_mask)
+                return first + first_lane_<CharT>(mask);
+        }
+    }
+
+    for (; first != last && is_space_(*first); ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @return a pointer past the last character in [first, last) that is not whitespace, or first
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *skip_space_backward_kernel_(CharT const *first,
+                                                                                  CharT const *last) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const space = vec::broadcast(CharT(' '));
+        auto const tab = vec::broadcast(CharT('\t'));
+        auto const controls = vec::broadcast(CharT(5));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; last -= vec::size)
+        {
+            auto const v = vec::load(last - vec::size);
+
+            if (auto const mask = ~((v == space) | ((v - tab) < controls)).mask() & vec::full_mask)
+            {
+                auto const lane = (31uz - static_cast<::std::size_t>(::std::countl_zero(mask))) / sizeof(CharT);
+
+                return last - vec::size + lane + 1uz;
+            }
+        }
+    }
+
+    for (; first != last && is_space_(*(last - 1)); --last)
+        ;
+
+    return last;
+}
+
+/**
+ * @return a pointer to the first whitespace in [first, last), or last
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline CharT const *find_space_kernel_(CharT const *first, CharT const *last) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const space = vec::broadcast(CharT(' '));
+        auto const tab = vec::broadcast(CharT('\t'));
+        auto const controls = vec::broadcast(CharT(5));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            auto const v = vec::load(first);
+
+            if (auto const mask = ((v == space) | ((v - tab) < controls)).mask())
+                return first + first_lane_<CharT>(mask);
+        }
+    }
+
+    for (; first != last && !is_space_(*first); ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @brief replaces every from in [first, last) with to
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline void replace_char_kernel_(CharT *first, CharT *last, CharT from,
+                                                                   CharT to) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const needle = vec::broadcast(from);
+        auto const flip = vec::broadcast(static_cast<CharT>(from ^ to));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            auto const v = vec::load(first);
+            (v ^ ((v == needle) & flip)).store(first);
+        }
+    }
+
+    for (; first != last; ++first)
+    {
+        if (*first == from)
+            *first = to;
+    }
+}
+
+/**
+ * @return number of ch in [first, last)
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline ::std::size_t count_char_kernel_(CharT const *first, CharT const *last,
+                                                                          CharT ch) noexcept
+{
+    auto count = 0uz;
+
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const needle = vec::broadcast(ch);
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+            count += static_cast<::std::size_t>(::std::popcount((vec::load(first) == needle).mask()));
+
+        // every lane sets sizeof(CharT) bits
+        count /= sizeof(CharT);
+    }
+
+    for (; first != last; ++first)
+        count += *first == ch;
+
+    return count;
+}
+
+/**
+ * @brief toggles the case of ASCII letters in [a, a + 26) where a is 'A' or 'a'
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline void ascii_case_kernel_(CharT *first, CharT *last, CharT a) noexcept
+{
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const letter_a = vec::broadcast(a);
+        auto const letters = vec::broadcast(CharT(26));
+        auto const flip = vec::broadcast(CharT(0x20));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            auto const v = vec::load(first);
+            (v ^ (((v - letter_a) < letters) & flip)).store(first);
+        }
+    }
+
+    for (; first != last; ++first)
+    {
+        if (static_cast<::std::make_unsigned_t<CharT>>(*first - a) < 26u)
+            *first ^= CharT(0x20);
+    }
+}
+
+/**
+ * @return the first index where the characters differ after converting ASCII letters to lower case, or size
+ */
+template <typename Vec, typename CharT>
+BIZWEN_BASIC_STRING_KERNEL_INLINE inline ::std::size_t ascii_mismatch_icase_kernel_(CharT const *lhs, CharT const *rhs,
+                                                                                    ::std::size_t size) noexcept
+{
+    auto i = 0uz;
+
+    if constexpr (!::std::is_void_v<Vec>)
+    {
+        using vec = Vec;
+        auto const letter_a = vec::broadcast(CharT('A'));
+        auto const letters = vec::broadcast(CharT(26));
+        auto const flip = vec::broadcast(CharT(0x20));
+
+        // no lambda, which would take the vectors as arguments of a function not compiled for the target
+        for (; size - i >= vec::size; i += vec::size)
+        {
+            auto const l = vec::load(lhs + i);
+            auto const r = vec::load(rhs + i);
+            auto const lower_l = l | (((l - letter_a) < letters) & flip);
+            auto const lower_r = r | (((r - letter_a) < letters) & flip);
+
+            if (auto const mask = (lower_l == lower_r).mask(); mask != vec::full_mask)
+                return i + first_lane_<CharT>(~mask);
+        }
+    }
+
+    return i;
+}
+
+// ********************************* begin dispatch ******************************
+
+#if defined(BIZWEN_BASIC_STRING_AVX2)
+inline constexpr simd_level simd_compiled_level_{simd_level::avx2};
+#elif defined(BIZWEN_BASIC_STRING_SSE2)
+inline constexpr simd_level simd_compiled_level_{simd_level::sse2};
+#else
+inline constexpr simd_level simd_compiled_level_{simd_level::scalar};
+#endif
+
+/**
+ * @brief the highest level which can be selected, BIZWEN_SIMD_LEVEL (0 for scalar, 1 for sse2, 2 for avx2) lowers it
+ */
+#if defined(BIZWEN_SIMD_LEVEL)
+inline constexpr simd_level simd_max_level_{
+    ::std::ranges::min(simd_compiled_level_, static_cast<simd_level>(BIZWEN_SIMD_LEVEL))};
+#else
+inline constexpr simd_level simd_max_level_{simd_compiled_level_};
+#endif
+
+/**
+ * @brief the kernels of one level for CharT
+ */
+template <typename CharT>
+struct simd_kernels_
+{
+    CharT const *(*ascii_prefix)(CharT const *, CharT const *) noexcept;
+    CharT const *(*find_char)(CharT const *, CharT const *, CharT) noexcept;
+    CharT const *(*find_first_of)(CharT const *, CharT const *, CharT const *, ::std::size_t) noexcept;
+    CharT const *(*search)(CharT const *, CharT const *, CharT const *, ::std::size_t) noexcept;
+    CharT const *(*skip_space)(CharT const *, CharT const *) noexcept;
+    CharT const *(*skip_space_backward)(CharT const *, CharT const *) noexcept;
+    CharT const *(*find_space)(CharT const *, CharT const *) noexcept;
+    void (*replace_char)(CharT *, CharT *, CharT, CharT) noexcept;
+    ::std::size_t (*count_char)(CharT const *, CharT const *, CharT) noexcept;
+    void (*ascii_case)(CharT *, CharT *, CharT) noexcept;
+    ::std::size_t (*ascii_mismatch_icase)(CharT const *, CharT const *, ::std::size_t) noexcept;
+};
+
+template <auto Kernel>
+struct direct_entry_
+{
+    static inline constexpr auto call{Kernel};
+};
+
+#if defined(BIZWEN_BASIC_STRING_DISPATCH)
+/**
+ * @brief the translation unit is not compiled for AVX2, so each AVX2 kernel is inlined into an entry which is, the
+ * @brief kernels are always_inline since flatten does not inline at -O0
+ */
+template <auto Kernel>
+struct avx2_entry_;
+
+template <typename R, typename... Args, R (*Kernel)(Args...) noexcept>
+struct avx2_entry_<Kernel>
+{
+    [[gnu::target("avx2")]] static R call(Args... args) noexcept
+    {
+        return Kernel(args...);
+    }
+};
+#else
+template <auto Kernel>
+struct avx2_entry_ : direct_entry_<Kernel>
+{
+};
+#endif
+
+template <typename Vec, typename CharT, template <auto> typename Entry = direct_entry_>
+inline constexpr simd_kernels_<CharT> simd_kernels_of_{
+    Entry<&ascii_prefix_kernel_<Vec, CharT>>::call,    Entry<&find_char_kernel_<Vec, CharT>>::call,
+    Entry<&find_first_of_kernel_<Vec, CharT>>::call,   Entry<&search_kernel_<Vec, CharT>>::call,
+    Entry<&skip_space_kernel_<Vec, CharT>>::call,      Entry<&skip_space_backward_kernel_<Vec, CharT>>::call,
+    Entry<&find_space_kernel_<Vec, CharT>>::call,      Entry<&replace_char_kernel_<Vec, CharT>>::call,
+    Entry<&count_char_kernel_<Vec, CharT>>::call,      Entry<&ascii_case_kernel_<Vec, CharT>>::call,
+    Entry<&ascii_mismatch_icase_kernel_<Vec, CharT>>::call};
+
+template <typename CharT>
+inline constexpr simd_kernels_<CharT> const &select_simd_kernels_(simd_level level) noexcept
+{
+#if defined(BIZWEN_BASIC_STRING_AVX2)
+    if (level == simd_level::avx2)
+        return simd_kernels_of_<avx2_vec_<CharT>, CharT, avx2_entry_>;
+#endif
+#if defined(BIZWEN_BASIC_STRING_SSE2)
+    if (level >= simd_level::sse2)
+        return simd_kernels_of_<sse2_vec_<CharT>, CharT>;
+#endif
+
+    return simd_kernels_of_<void, CharT>;
+}
+
+#if defined(BIZWEN_BASIC_STRING_DISPATCH)
+/**
+ * @brief the level supported by the CPU, which the environment variable BIZWEN_SIMD_LEVEL (scalar or 0, sse2 or 1)
+ * @brief can lower, a level above simd_max_level_ is never selected
+ */
+inline simd_level detect_simd_level_() noexcept
+{
+    auto level = simd_max_level_;
+    __builtin_cpu_init();
+
+    if (level == simd_level::avx2 && !__builtin_cpu_supports("avx2"))
+        level = simd_level::sse2;
+
+    if (auto const env = ::std::getenv("BIZWEN_SIMD_LEVEL"))
+    {
+        ::std::string_view const name{env};
+
+        if (name == "scalar" || name == "0")
+            level = simd_level::scalar;
+        else if ((name == "sse2" || name == "1") && level > simd_level::sse2)
+            level = simd_level::sse2;
+    }
+
+    return level;
+}
+#endif
+
+/**
+ * @brief with BIZWEN_BASIC_STRING_DISPATCH the level is detected at the first call, otherwise it is a constant and
+ * @brief the kernels are called directly
+ */
+inline simd_level simd_level_() noexcept
+{
+#if defined(BIZWEN_BASIC_STRING_DISPATCH)
+    static simd_level const level{detect_simd_level_()};
+
+    return level;
+#else
+    return simd_max_level_;
+#endif
+}
+
+template <typename CharT>
+inline simd_kernels_<CharT> const &simd_kernels_table_() noexcept
+{
+#if defined(BIZWEN_BASIC_STRING_DISPATCH)
+    static simd_kernels_<CharT> const &table{select_simd_kernels_<CharT>(simd_level_())};
+
+    return table;
+#else
+    static constexpr simd_kernels_<CharT> const &table{select_simd_kernels_<CharT>(simd_max_level_)};
+
+    return table;
+#endif
+}
+
+// the entries of the kernels, which call the kernels of the selected level
+
+template <typename CharT>
+inline CharT const *ascii_prefix_(CharT const *first, CharT const *last) noexcept
+{
+    return simd_kernels_table_<CharT>().ascii_prefix(first, last);
+}
+
+template <typename CharT>
+inline CharT const *find_char_(CharT const *first, CharT const *last, CharT ch) noexcept
+{
+    return simd_kernels_table_<CharT>().find_char(first, last, ch);
+}
+
+template <typename CharT>
+inline CharT const *find_first_of_(CharT const *first, CharT const *last, CharT const *set,
+                                   ::std::size_t set_size) noexcept
+{
+    return simd_kernels_table_<CharT>().find_first_of(first, last, set, set_size);
+}
+
+template <typename CharT>
+inline CharT const *search_(CharT const *first, CharT const *last, CharT const *needle, ::std::size_t size) noexcept
+{
+    return simd_kernels_table_<CharT>().search(first, last, needle, size);
+}
+
+template <typename CharT>
+inline CharT const *skip_space_(CharT const *first, CharT const *last) noexcept
+{
+    return simd_kernels_table_<CharT>().skip_space(first, last);
+}
+
+template <typename CharT>
+inline CharT const *skip_space_backward_(CharT const *first, CharT const *last) noexcept
+{
+    return simd_kernels_table_<CharT>().skip_space_backward(first, last);
+}
+
+template <typename CharT>
+inline CharT const *find_space_(CharT const *first, CharT const *last) noexcept
+{
+    return simd_kernels_table_<CharT>().find_space(first, last);
+}
+
+template <typename CharT>
+inline void replace_char_(CharT *first, CharT *last, CharT from, CharT to) noexcept
+{
+    simd_kernels_table_<CharT>().replace_char(first, last, from, to);
+}
+
+template <typename CharT>
+inline ::std::size_t count_char_(CharT const *first, CharT const *last, CharT ch) noexcept
+{
+    return simd_kernels_table_<CharT>().count_char(first, last, ch);
+}
+
+template <typename CharT>
+inline void ascii_case_(CharT *first, CharT *last, CharT a) noexcept
+{
+    simd_kernels_table_<CharT>().ascii_case(first, last, a);
+}
+
+template <typename CharT>
+inline ::std::size_t ascii_mismatch_icase_(CharT const *lhs, CharT const *rhs, ::std::size_t size) noexcept
+{
+    return simd_kernels_table_<CharT>().ascii_mismatch_icase(lhs, rhs, size);
+}
+
+/**
+ * @brief removes every ch in [first, last), the runs between them are found with find_char_ and moved to the front
+ * @return the new end
+ */
+template <typename CharT>
+inline CharT *remove_char_(CharT *first, CharT *last, CharT ch) noexcept
+{
+    auto write = first + (find_char_(first, last, ch) - first);
+
+    if (write == last)
+        return last;
+
+    for (CharT const *read = write + 1; read != last;)
+    {
+        auto const next = find_char_(read, last, ch);
+        write = ::std::ranges::copy(read, next, write).out;
+
+        if (next == last)
+            break;
+
+        read = next + 1;
+    }
+
+    return write;
+}
+
+/**
+ * @brief removes every character of [set, set + set_size) in [first, last), see remove_char_
+ * @return the new end
+ */
+template <typename CharT>
+inline CharT *remove_any_of_(CharT *first, CharT *last, CharT const *set, ::std::size_t set_size) noexcept
+{
+    auto write = first + (find_first_of_(first, last, set, set_size) - first);
+
+    if (write == last)
+        return last;
+
+    for (CharT const *read = write + 1; read != last;)
+    {
+        auto const next = find_first_of_(read, last, set, set_size);
+        write = ::std::ranges::copy(read, next, write).out;
+
+        if (next == last)
+            break;
+
+        read = next + 1;
+    }
+
+    return write;
+}
+} // namespace detail
+
+/**
+ * @return the level of the kernels used by the runtime branches, with runtime dispatch it is the highest level
+ * @return supported by the CPU unless the environment variable BIZWEN_SIMD_LEVEL lowers it
+ */
+inline simd_level active_simd_level() noexcept
+{
+    return detail::simd_level_();
+}
+
 template <typename CharT, typename Traits = ::std::char_traits<CharT>, typename Allocator = ::std::allocator<CharT>>
 class alignas(CharT *) basic_string
 {
@@ -56,6 +974,18 @@ class alignas(CharT *) basic_string
 
     static inline constexpr size_type npos = size_type(-1);
 
+    /**
+     * @brief heap buffer transferred by release() and adopt()
+     * @brief data points to capacity + 1 elements allocated by allocator, data[size] is the null terminator
+     */
+    struct buffer_type
+    {
+        pointer data{};
+        size_type size{};
+        size_type capacity{};
+        allocator_type allocator;
+    };
+
   private:
     /**
      * @brief type of long string
@@ -1129,6 +2059,14 @@ class alignas(CharT *) basic_string
     {
     }
 
+    /**
+     * @brief take over the buffer, see adopt
+     */
+    constexpr explicit basic_string(buffer_type buf) : allocator_(buf.allocator)
+    {
+        adopt(::std::move(buf));
+    }
+
     // ********************************* begin assign ******************************
 
   private:
@@ -1519,97 +2457,345 @@ class alignas(CharT *) basic_string
 
     // ********************************* begin operator+= ******************************
 
-    constexpr basic_string &operator+=(const basic_string &str)
+    constexpr basic_string &operator+=(const basic_string &str)
+    {
+        return append(str);
+    }
+
+    constexpr basic_string &operator+=(CharT ch)
+    {
+        push_back(ch);
+
+        return *this;
+    }
+
+    constexpr basic_string &operator+=(CharT const *s)
+    {
+        return append(s);
+    }
+
+    constexpr basic_string &operator+=(::std::initializer_list<CharT> ilist)
+    {
+        return append(ilist);
+    }
+
+    // clang-format off
+    template <typename StringViewLike>
+        requires ::std::is_convertible_v<StringViewLike const&, ::std::basic_string_view<value_type, traits_type>> && (!::std::is_convertible_v<StringViewLike const&, CharT const*>)
+    constexpr basic_string& operator+=(StringViewLike const& t)
+    {
+        return append(t);
+    }
+    // clang-format on
+
+    // ********************************* begin search ******************************
+
+  public:
+    constexpr bool starts_with(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    {
+        return sv.size() <= size_() && equal_(sv.data(), sv.data() + sv.size(), begin_(), begin_() + sv.size());
+    }
+
+    constexpr bool starts_with(CharT ch) const noexcept
+    {
+        return *begin_() == ch;
+    }
+
+    constexpr bool starts_with(CharT const *s) const
+    {
+        auto const length = c_string_length_(s);
+
+        return length <= size_() && equal_(s, s + length, begin_(), begin_() + length);
+    }
+
+    constexpr bool ends_with(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    {
+        return sv.size() <= size_() && equal_(sv.data(), sv.data() + sv.size(), end_() - sv.size(), end_());
+    }
+
+    constexpr bool ends_with(CharT ch) const noexcept
+    {
+        return !empty() && *(end_() - 1) == ch;
+    }
+
+    constexpr bool ends_with(CharT const *s) const
+    {
+        auto const length = c_string_length_(s);
+
+        return length <= size_() && equal_(s, s + length, end_() - length, end_());
+    }
+
+#if defined(__cpp_lib_string_contains) && (__cpp_lib_string_contains >= 202011L)
+    constexpr bool contains(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    {
+        return ::std::basic_string_view<value_type, traits_type>{begin_(), end_()}.contains(sv);
+    }
+
+    constexpr bool contains(CharT ch) const noexcept
+    {
+        for (auto begin = begin_(), end = end_(); begin != end; ++begin)
+        {
+            if (*begin == ch)
+                return true;
+        }
+
+        return false;
+    }
+
+    constexpr bool contains(CharT const *s) const noexcept
+    {
+        return ::std::basic_string_view<value_type, traits_type>{begin_(), end_()}.contains(
+            ::std::basic_string_view<value_type, traits_type>{s, s + c_string_length_(s)});
+    }
+#endif
+
+    constexpr size_type count(CharT ch) const noexcept
+    {
+        auto begin = begin_();
+        auto const end = end_();
+
+        if !consteval
+        {
+            return detail::count_char_(begin, end, ch);
+        }
+
+        size_type count{};
+
+        for (; begin != end; ++begin)
+            count += *begin == ch;
+
+        return count;
+    }
+
+    // ********************************* begin case conversion ******************************
+
+  private:
+    constexpr static void ascii_case_(CharT *first, CharT *last, CharT a) noexcept
+    {
+        if !consteval
+        {
+            return detail::ascii_case_(first, last, a);
+        }
+
+        for (; first != last; ++first)
+        {
+            if (static_cast<::std::make_unsigned_t<CharT>>(*first - a) < 26u)
+                *first ^= CharT(0x20);
+        }
+    }
+
+    constexpr static auto ascii_lower_(CharT ch) noexcept
+    {
+        using uchar = ::std::make_unsigned_t<CharT>;
+
+        return static_cast<uchar>(ch - CharT('A')) < 26u ? static_cast<uchar>(ch | CharT(0x20)) : static_cast<uchar>(ch);
+    }
+
+    /**
+     * @brief characters are compared as unsigned integers after converting ASCII letters to lower case
+     */
+    constexpr static ::std::strong_ordering icompare_(CharT const *lhs, size_type lsize, CharT const *rhs,
+                                                      size_type rsize) noexcept
+    {
+        auto const size = ::std::ranges::min(lsize, rsize);
+        auto i = 0uz;
+
+        if !consteval
+        {
+            i = detail::ascii_mismatch_icase_(lhs, rhs, size);
+        }
+
+        for (; i != size; ++i)
+        {
+            if (auto const l = ascii_lower_(lhs[i]), r = ascii_lower_(rhs[i]); l != r)
+                return l <=> r;
+        }
+
+        return lsize <=> rsize;
+    }
+
+  public:
+    /**
+     * @brief convert ASCII letters to lower case, other characters are unchanged
+     */
+    constexpr void to_ascii_lower() noexcept
+    {
+        ascii_case_(begin_(), end_(), CharT('A'));
+    }
+
+    /**
+     * @brief convert ASCII letters to upper case, other characters are unchanged
+     */
+    constexpr void to_ascii_upper() noexcept
+    {
+        ascii_case_(begin_(), end_(), CharT('a'));
+    }
+
+    friend constexpr ::std::strong_ordering icompare(basic_string const &lhs, basic_string const &rhs) noexcept
+    {
+        return icompare_(lhs.begin_(), lhs.size_(), rhs.begin_(), rhs.size_());
+    }
+
+    friend constexpr ::std::strong_ordering icompare(basic_string const &lhs,
+                                                     ::std::basic_string_view<value_type, traits_type> rhs) noexcept
+    {
+        return icompare_(lhs.begin_(), lhs.size_(), rhs.data(), rhs.size());
+    }
+
+    friend constexpr ::std::strong_ordering icompare(::std::basic_string_view<value_type, traits_type> lhs,
+                                                     basic_string const &rhs) noexcept
     {
-        return append(str);
+        return icompare_(lhs.data(), lhs.size(), rhs.begin_(), rhs.size_());
     }
 
-    constexpr basic_string &operator+=(CharT ch)
+    friend constexpr ::std::strong_ordering icompare(basic_string const &lhs, CharT const *rhs) noexcept
     {
-        push_back(ch);
+        return icompare_(lhs.begin_(), lhs.size_(), rhs, c_string_length_(rhs));
+    }
 
-        return *this;
+    friend constexpr ::std::strong_ordering icompare(CharT const *lhs, basic_string const &rhs) noexcept
+    {
+        return icompare_(lhs, c_string_length_(lhs), rhs.begin_(), rhs.size_());
     }
 
-    constexpr basic_string &operator+=(CharT const *s)
+    friend constexpr bool iequals(basic_string const &lhs, basic_string const &rhs) noexcept
     {
-        return append(s);
+        return lhs.size_() == rhs.size_() && icompare(lhs, rhs) == 0;
     }
 
-    constexpr basic_string &operator+=(::std::initializer_list<CharT> ilist)
+    friend constexpr bool iequals(basic_string const &lhs, ::std::basic_string_view<value_type, traits_type> rhs) noexcept
     {
-        return append(ilist);
+        return lhs.size_() == rhs.size() && icompare(lhs, rhs) == 0;
     }
 
-    // clang-format off
-    template <typename StringViewLike>
-        requires ::std::is_convertible_v<StringViewLike const&, ::std::basic_string_view<value_type, traits_type>> && (!::std::is_convertible_v<StringViewLike const&, CharT const*>)
-    constexpr basic_string& operator+=(StringViewLike const& t)
+    friend constexpr bool iequals(::std::basic_string_view<value_type, traits_type> lhs, basic_string const &rhs) noexcept
     {
-        return append(t);
+        return lhs.size() == rhs.size_() && icompare(lhs, rhs) == 0;
     }
-    // clang-format on
 
-    // ********************************* begin search ******************************
+    friend constexpr bool iequals(basic_string const &lhs, CharT const *rhs) noexcept
+    {
+        return iequals(lhs, ::std::basic_string_view<value_type, traits_type>(rhs, c_string_length_(rhs)));
+    }
 
-  public:
-    constexpr bool starts_with(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    friend constexpr bool iequals(CharT const *lhs, basic_string const &rhs) noexcept
     {
-        return sv.size() <= size_() && equal_(sv.data(), sv.data() + sv.size(), begin_(), begin_() + sv.size());
+        return iequals(rhs, lhs);
     }
 
-    constexpr bool starts_with(CharT ch) const noexcept
+    // ********************************* begin trim ******************************
+
+  private:
+    constexpr static CharT const *skip_space_(CharT const *first, CharT const *last) noexcept
     {
-        return *begin_() == ch;
+        if !consteval
+        {
+            return detail::skip_space_(first, last);
+        }
+
+        for (; first != last && detail::is_space_(*first); ++first)
+            ;
+
+        return first;
     }
 
-    constexpr bool starts_with(CharT const *s) const
+    constexpr static CharT const *skip_space_backward_(CharT const *first, CharT const *last) noexcept
     {
-        auto const length = c_string_length_(s);
+        if !consteval
+        {
+            return detail::skip_space_backward_(first, last);
+        }
 
-        return length <= size_() && equal_(s, s + length, begin_(), begin_() + length);
+        for (; first != last && detail::is_space_(*(last - 1)); --last)
+            ;
+
+        return last;
     }
 
-    constexpr bool ends_with(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    constexpr static CharT const *find_space_(CharT const *first, CharT const *last) noexcept
     {
-        return sv.size() <= size_() && equal_(sv.data(), sv.data() + sv.size(), end_() - sv.size(), end_());
+        if !consteval
+        {
+            return detail::find_space_(first, last);
+        }
+
+        for (; first != last && !detail::is_space_(*first); ++first)
+            ;
+
+        return first;
     }
 
-    constexpr bool ends_with(CharT ch) const noexcept
+  public:
+    /**
+     * @brief removes leading whitespace, whitespace is ' ', '\t', '\n', '\v', '\f' and '\r'
+     */
+    constexpr void trim_left() noexcept
     {
-        return !empty() && *(end_() - 1) == ch;
+        auto const begin = begin_();
+
+        if (auto const first = skip_space_(begin, end_()); first != begin)
+            erase_(begin, first);
     }
 
-    constexpr bool ends_with(CharT const *s) const
+    /**
+     * @brief removes trailing whitespace, the capacity is unchanged
+     */
+    constexpr void trim_right() noexcept
     {
-        auto const length = c_string_length_(s);
+        auto const begin = begin_();
 
-        return length <= size_() && equal_(s, s + length, end_() - length, end_());
+        resize_shrink_(is_long_(), skip_space_backward_(begin, end_()) - begin);
     }
 
-#if defined(__cpp_lib_string_contains) && (__cpp_lib_string_contains >= 202011L)
-    constexpr bool contains(::std::basic_string_view<value_type, traits_type> sv) const noexcept
+    /**
+     * @brief removes leading and trailing whitespace, the capacity is unchanged
+     */
+    constexpr void trim() noexcept
     {
-        return ::std::basic_string_view<value_type, traits_type>{begin_(), end_()}.contains(sv);
+        trim_right();
+        trim_left();
     }
 
-    constexpr bool contains(CharT ch) const noexcept
+    /**
+     * @return a view of the string without leading and trailing whitespace
+     */
+    constexpr ::std::basic_string_view<value_type, traits_type> trim_view() const noexcept
     {
-        for (auto begin = begin_(), end = end_(); begin != end; ++begin)
-        {
-            if (*begin == ch)
-                return true;
-        }
+        auto const first = skip_space_(begin_(), end_());
 
-        return false;
+        return {first, skip_space_backward_(first, end_())};
     }
 
-    constexpr bool contains(CharT const *s) const noexcept
+    /**
+     * @brief replaces every run of whitespace with a single ' ', leading and trailing runs are kept as one ' ' too
+     */
+    constexpr void collapse_whitespace() noexcept
     {
-        return ::std::basic_string_view<value_type, traits_type>{begin_(), end_()}.contains(
-            ::std::basic_string_view<value_type, traits_type>{s, s + c_string_length_(s)});
+        auto const is_long = is_long_();
+        auto const begin = begin_();
+        auto const last = end_();
+        CharT const *read = begin;
+        auto write = begin;
+
+        for (;;)
+        {
+            auto const space = find_space_(read, last);
+
+            // the characters are already in place while nothing has been removed
+            if (write != read)
+                write = ::std::ranges::copy(read, space, write).out;
+            else
+                write += space - read;
+
+            if (space == last)
+                break;
+
+            *write++ = CharT(' ');
+            read = skip_space_(space, last);
+        }
+
+        resize_shrink_(is_long, write - begin);
     }
-#endif
 
     // ********************************* begin substr ******************************
 
@@ -2032,6 +3218,215 @@ class alignas(CharT *) basic_string
         return *this;
     }
 
+    // ********************************* begin replace_all ******************************
+
+  private:
+    /**
+     * @brief a match of replace_all, pos is the end of the searched range if there are no more matches
+     */
+    struct match_
+    {
+        CharT const *pos;
+        size_type length;
+        ::std::basic_string_view<value_type, traits_type> replacement;
+    };
+
+    constexpr static CharT const *search_(CharT const *first, CharT const *last, CharT const *needle,
+                                          size_type size) noexcept
+    {
+        if !consteval
+        {
+            return detail::search_(first, last, needle, size);
+        }
+
+        return ::std::ranges::search(first, last, needle, needle + size).begin();
+    }
+
+    constexpr static CharT const *find_first_of_(CharT const *first, CharT const *last, CharT const *set,
+                                                 size_type size) noexcept
+    {
+        if !consteval
+        {
+            return detail::find_first_of_(first, last, set, size);
+        }
+
+        return ::std::ranges::find_first_of(first, last, set, set + size);
+    }
+
+    /**
+     * @brief replaces the matches returned by find(first, last), which are searched from left to right
+     * @brief unless the result is allocated, it is written from the front over the string, which is first moved back
+     * @brief by the largest growth of a prefix of the result, so the writes never overtake the characters to be read
+     * @param shrinks, no replacement is longer than its match, so nothing is moved and the string is searched once,
+     * @param shrinks, otherwise the size is counted first
+     * @param aliases, a pattern or a replacement refers to *this, so the result is allocated
+     */
+    template <typename Find>
+    constexpr void replace_matches_(Find find, bool shrinks, bool aliases)
+    {
+        auto const begin = begin_();
+        auto end = end_();
+        auto const is_long = is_long_();
+        CharT const *read = begin;
+
+        if (!shrinks || aliases)
+        {
+            auto const size = size_();
+            auto new_size = size;
+            auto max_size = size;
+            auto found = false;
+
+            for (auto m = find(begin, end); m.pos != end; m = find(m.pos + m.length, end))
+            {
+                new_size = new_size - m.length + m.replacement.size();
+                max_size = ::std::ranges::max(max_size, new_size);
+                found = true;
+            }
+
+            if (!found)
+                return;
+
+            if (aliases || capacity() < max_size)
+            {
+                auto const ls = allocate_(new_size, new_size);
+                auto out = ls.begin();
+
+                for (auto m = find(read, end); m.pos != end; m = find(read, end))
+                {
+                    out = ::std::ranges::copy(read, m.pos, out).out;
+                    out = ::std::ranges::copy(m.replacement, out).out;
+                    read = m.pos + m.length;
+                }
+
+                ::std::ranges::copy(read, end, out);
+                dealloc_(is_long);
+                long_str_(ls);
+
+                return;
+            }
+
+            auto const shift = max_size - size;
+            ::std::ranges::copy_backward(begin, end, end + shift);
+            read += shift;
+            end += shift;
+        }
+
+        auto write = begin;
+
+        for (auto m = find(read, end); m.pos != end; m = find(read, end))
+        {
+            // the characters are already in place while nothing has been moved
+            if (write != read)
+                write = ::std::ranges::copy(read, m.pos, write).out;
+            else
+                write += m.pos - read;
+
+            write = ::std::ranges::copy(m.replacement, write).out;
+            read = m.pos + m.length;
+        }
+
+        if (write != read)
+            write = ::std::ranges::copy(read, end, write).out;
+        else
+            write += end - read;
+
+        resize_shrink_(is_long, write - begin);
+    }
+
+  public:
+    /**
+     * @brief replaces every non-overlapping occurrence of from, searched from left to right, with to
+     * @brief from and to may refer to *this, an empty from matches nothing
+     */
+    constexpr basic_string &replace_all(::std::basic_string_view<value_type, traits_type> from,
+                                        ::std::basic_string_view<value_type, traits_type> to)
+    {
+        if (from.empty())
+            return *this;
+
+        auto const begin = begin_();
+        auto const end = end_();
+        auto const aliases = overlap(from.data(), from.data() + from.size(), begin, end) ||
+                             overlap(to.data(), to.data() + to.size(), begin, end);
+
+        replace_matches_(
+            [from, to](CharT const *first, CharT const *last) noexcept {
+                return match_{search_(first, last, from.data(), from.size()), from.size(), to};
+            },
+            to.size() <= from.size(), aliases);
+
+        return *this;
+    }
+
+    constexpr basic_string &replace_all(CharT from, CharT to) noexcept
+    {
+        auto first = begin_();
+        auto const last = end_();
+
+        if !consteval
+        {
+            detail::replace_char_(first, last, from, to);
+
+            return *this;
+        }
+
+        for (; first != last; ++first)
+        {
+            if (*first == from)
+                *first = to;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief replaces the first of each pair with the second, at every position the first pair that matches wins
+     * @brief the pairs may refer to *this, pairs with an empty first are ignored
+     */
+    constexpr basic_string &replace_all(
+        ::std::initializer_list<::std::pair<::std::basic_string_view<value_type, traits_type>,
+                                            ::std::basic_string_view<value_type, traits_type>>>
+            pairs)
+    {
+        using view = ::std::basic_string_view<value_type, traits_type>;
+        auto const begin = begin_();
+        auto const end = end_();
+        auto shrinks = true;
+        auto aliases = false;
+        // the first characters of the patterns, which are searched before comparing the patterns
+        bizwen::basic_string<CharT, Traits> heads;
+
+        for (auto const &[from, to] : pairs)
+        {
+            if (from.empty())
+                continue;
+
+            if (!view(heads).contains(from.front()))
+                heads.push_back(from.front());
+
+            shrinks = shrinks && to.size() <= from.size();
+            aliases = aliases || overlap(from.data(), from.data() + from.size(), begin, end) ||
+                      overlap(to.data(), to.data() + to.size(), begin, end);
+        }
+
+        replace_matches_(
+            [pairs, &heads](CharT const *first, CharT const *last) noexcept {
+                for (; (first = find_first_of_(first, last, heads.data(), heads.size())) != last; ++first)
+                {
+                    for (auto const &[from, to] : pairs)
+                    {
+                        if (!from.empty() && view(first, last).starts_with(from))
+                            return match_{first, from.size(), to};
+                    }
+                }
+
+                return match_{last, 0uz, view{}};
+            },
+            shrinks, aliases);
+
+        return *this;
+    }
+
     // ********************************* begin assign_range/insert_range/append_range ******************************
 #if defined(__cpp_lib_containers_ranges) && (__cpp_lib_containers_ranges >= 202202L)
     template <::std::ranges::input_range R>
@@ -2130,6 +3525,65 @@ class alignas(CharT *) basic_string
     {
         return allocator_;
     }
+
+    // ********************************* begin buffer ownership ******************************
+
+    /**
+     * @brief transfer the buffer to the caller and leave *this empty
+     * @brief a short string is copied to a new allocated buffer first
+     * @brief strong exception safety guarantee
+     * @return the buffer, which should be deallocated by buffer_type::allocator with capacity + 1
+     */
+    constexpr buffer_type release()
+    {
+        auto const size = size_();
+
+        if (is_short_())
+        {
+            auto const ls = allocate_(size, size);
+            ::std::ranges::copy(begin_(), end_(), ls.begin());
+            long_str_(ls);
+        }
+
+        auto const &ls = long_str_();
+        buffer_type buf{ls.begin_, size, static_cast<size_type>(ls.last_ - ls.begin()), allocator_};
+        short_str_(0uz);
+
+        return buf;
+    }
+
+    /**
+     * @brief replace the content with the buffer
+     * @brief the buffer is taken over if buf.allocator == get_allocator() and it is larger than a short string,
+     * @brief otherwise the characters are copied, and the buffer is deallocated by buf.allocator
+     * @param buf, the buffer is owned by *this even if an exception is thrown
+     */
+    constexpr void adopt(buffer_type buf)
+    {
+        assert(buf.size <= buf.capacity);
+        auto const first = ::std::to_address(buf.data);
+
+        if (buf.capacity > short_str_max_ && buf.allocator == allocator_)
+        {
+            dealloc_(is_long_());
+            long_str_({buf.data, first + buf.size, first + buf.capacity});
+
+            return;
+        }
+
+        struct buffer_guard_
+        {
+            buffer_type &buf;
+
+            constexpr ~buffer_guard_()
+            {
+                atraits_t_::deallocate(buf.allocator, buf.data,
+                                       static_cast<atraits_t_::size_type>(buf.capacity + 1uz /* null terminator */));
+            }
+        } g{buf};
+
+        assign_(first, first + buf.size);
+    }
 };
 
 template <class InputIterator,
@@ -2240,6 +3694,19 @@ template <class CharT, class Traits, class Alloc, class U = CharT>
 inline constexpr typename basic_string<CharT, Traits, Alloc>::size_type erase(basic_string<CharT, Traits, Alloc> &c,
                                                                               const U &value)
 {
+    if constexpr (::std::is_same_v<U, CharT>)
+    {
+        if !consteval
+        {
+            auto const first = c.data();
+            auto const last = first + c.size();
+            auto const r = static_cast<::std::size_t>(last - detail::remove_char_(first, last, value));
+            c.resize(c.size() - r);
+
+            return r;
+        }
+    }
+
     auto const r = std::ranges::size(std::ranges::remove(c, value));
     c.resize(c.size() - r);
 
@@ -2256,6 +3723,31 @@ inline constexpr typename basic_string<CharT, Traits, Alloc>::size_type erase_if
     return r;
 }
 
+/**
+ * @brief removes every character of c that is in chars
+ * @return number of removed characters
+ */
+template <class CharT, class Traits, class Alloc>
+inline constexpr typename basic_string<CharT, Traits, Alloc>::size_type erase_any_of(
+    basic_string<CharT, Traits, Alloc> &c, ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> chars)
+{
+    if !consteval
+    {
+        auto const first = c.data();
+        auto const last = first + c.size();
+        auto const r =
+            static_cast<::std::size_t>(last - detail::remove_any_of_(first, last, chars.data(), chars.size()));
+        c.resize(c.size() - r);
+
+        return r;
+    }
+
+    auto const r = std::ranges::size(std::ranges::remove_if(c, [chars](CharT ch) { return chars.find(ch) != chars.npos; }));
+    c.resize(c.size() - r);
+
+    return r;
+}
+
 using string = bizwen::basic_string<char>;
 using wstring = bizwen::basic_string<wchar_t>;
 using u8string = bizwen::basic_string<char8_t>;
@@ -2269,6 +3761,38 @@ static_assert(sizeof(u16string) == sizeof(char8_t *) * 4uz);
 static_assert(sizeof(u32string) == sizeof(char8_t *) * 4uz);
 static_assert(::std::contiguous_iterator<string::iterator>);
 
+inline namespace literals
+{
+inline namespace string_literals
+{
+// the length of a literal is known, so c_string_length_ is not called
+inline constexpr string operator""_bs(char const *str, ::std::size_t length)
+{
+    return string(str, length);
+}
+
+inline constexpr wstring operator""_bs(wchar_t const *str, ::std::size_t length)
+{
+    return wstring(str, length);
+}
+
+inline constexpr u8string operator""_bs(char8_t const *str, ::std::size_t length)
+{
+    return u8string(str, length);
+}
+
+inline constexpr u16string operator""_bs(char16_t const *str, ::std::size_t length)
+{
+    return u16string(str, length);
+}
+
+inline constexpr u32string operator""_bs(char32_t const *str, ::std::size_t length)
+{
+    return u32string(str, length);
+}
+} // namespace string_literals
+} // namespace literals
+
 namespace pmr
 {
 template <class CharT, class Traits = ::std::char_traits<CharT>>
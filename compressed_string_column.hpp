@@ -0,0 +1,643 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_COMPRESSED_STRING_COLUMN_HPP)
+#define BIZWEN_COMPRESSED_STRING_COLUMN_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+namespace detail
+{
+/**
+ * @brief reads size <= 8 bytes as a little-endian integer, the missing bytes are zero
+ */
+inline ::std::uint64_t load_symbol_(unsigned char const *in, ::std::size_t size) noexcept
+{
+    ::std::uint64_t value{};
+    ::std::memcpy(&value, in, size);
+
+    if constexpr (::std::endian::native == ::std::endian::big)
+        value = ::std::byteswap(value);
+
+    return value;
+}
+
+/**
+ * @brief writes all 8 bytes of value in little-endian order
+ */
+inline void store_symbol_(unsigned char *out, ::std::uint64_t value) noexcept
+{
+    if constexpr (::std::endian::native == ::std::endian::big)
+        value = ::std::byteswap(value);
+
+    ::std::memcpy(out, &value, sizeof(value));
+}
+
+inline constexpr ::std::uint64_t symbol_mask_(::std::size_t size) noexcept
+{
+    return size == 8uz ? ~::std::uint64_t{} : (::std::uint64_t{1} << (size * 8uz)) - 1u;
+}
+
+/**
+ * @brief the bytes of the characters of str, which are encoded by a symbol_table
+ */
+template <::std::ranges::contiguous_range R>
+inline ::std::span<unsigned char const> symbol_bytes_(R const &str) noexcept
+{
+    return {reinterpret_cast<unsigned char const *>(::std::ranges::data(str)),
+            ::std::ranges::size(str) * sizeof(::std::ranges::range_value_t<R>)};
+}
+} // namespace detail
+
+/**
+ * @brief a static table of up to 255 symbols of 1 to 8 bytes, which encodes a byte string as a sequence of codes,
+ * @brief see Boncz, Neumann and Leis, FSST: Fast Random Access String Compression
+ * @brief code i < 255 stands for the i-th symbol, code 255 is followed by a byte which is not covered by a symbol
+ * @brief the encoder takes the longest symbol at every position, so equal strings have equal encodings and can be
+ * @brief compared without decoding
+ */
+class symbol_table
+{
+    /**
+     * @brief the symbols sorted by first byte and then by descending size, so the candidates of a byte are adjacent
+     * @brief and the first which matches is the longest
+     */
+    ::std::array<::std::uint64_t, 255uz> symbols_{};
+    ::std::array<unsigned char, 255uz> sizes_{};
+    ::std::size_t count_{};
+
+    /**
+     * @brief the symbols starting with byte b are [first_[b], first_[b + 1])
+     */
+    ::std::array<::std::uint16_t, 257uz> first_{};
+
+    struct candidate_
+    {
+        ::std::uint64_t symbol;
+        ::std::size_t size;
+        ::std::size_t gain;
+    };
+
+    /**
+     * @brief code of the longest symbol which is a prefix of [in, in + size), or escape if there is none
+     * @param symbol_size, set to the size of the symbol, or 1 for escape
+     */
+    unsigned match_(unsigned char const *in, ::std::size_t size, ::std::size_t &symbol_size) const noexcept
+    {
+        auto const word = detail::load_symbol_(in, ::std::ranges::min(size, 8uz));
+
+        for (auto i = first_[in[0]]; i != first_[in[0] + 1uz]; ++i)
+        {
+            auto const length = static_cast<::std::size_t>(sizes_[i]);
+
+            if (length <= size && (word & detail::symbol_mask_(length)) == symbols_[i])
+            {
+                symbol_size = length;
+
+                return i;
+            }
+        }
+
+        symbol_size = 1uz;
+
+        return escape;
+    }
+
+    /**
+     * @brief the sample is encoded with the current table, every symbol and every pair of adjacent symbols which fits
+     * @brief in 8 bytes becomes a candidate, whose gain is its size times its number of occurrences, escaped bytes
+     * @brief count as symbols of size 1, the candidates with the largest gains form the next table
+     */
+    void train_round_(::std::vector<::std::span<unsigned char const>> const &sample)
+    {
+        // symbols are 0 to 254, an escaped byte b is 255 + b
+        constexpr auto code_count = 255uz + 256uz;
+        ::std::vector<::std::size_t> counts(code_count);
+        ::std::vector<::std::uint32_t> pair_counts(code_count * code_count);
+
+        auto const symbol_of = [this](::std::size_t code) {
+            return code < 255uz ? ::std::pair{symbols_[code], static_cast<::std::size_t>(sizes_[code])}
+                                : ::std::pair{static_cast<::std::uint64_t>(code - 255uz), 1uz};
+        };
+
+        for (auto const str : sample)
+        {
+            auto previous = code_count;
+
+            for (auto i = 0uz; i != str.size();)
+            {
+                auto size = 0uz;
+                auto code = static_cast<::std::size_t>(match_(str.data() + i, str.size() - i, size));
+
+                if (code == escape)
+                    code = 255uz + str[i];
+
+                ++counts[code];
+
+                if (previous != code_count)
+                    ++pair_counts[previous * code_count + code];
+
+                previous = code;
+                i += size;
+            }
+        }
+
+        // a symbol can be reached as a single code and as several pairs, so the gains are merged by value
+        ::std::map<::std::pair<::std::uint64_t, ::std::size_t>, ::std::size_t> gains;
+
+        for (auto first = 0uz; first != code_count; ++first)
+        {
+            if (counts[first] == 0uz)
+                continue;
+
+            auto const [symbol, size] = symbol_of(first);
+            gains[{symbol, size}] += counts[first] * size;
+
+            for (auto second = 0uz; second != code_count; ++second)
+            {
+                auto const count = pair_counts[first * code_count + second];
+
+                if (count == 0u)
+                    continue;
+
+                auto const [next_symbol, next_size] = symbol_of(second);
+
+                if (size + next_size <= 8uz)
+                    gains[{symbol | next_symbol << (size * 8uz), size + next_size}] += count * (size + next_size);
+            }
+        }
+
+        ::std::vector<candidate_> candidates;
+        candidates.reserve(gains.size());
+
+        for (auto const &[key, gain] : gains)
+            candidates.push_back({key.first, key.second, gain});
+
+        auto const kept = ::std::ranges::min(candidates.size(), 255uz);
+        ::std::ranges::partial_sort(candidates, candidates.begin() + static_cast<::std::ptrdiff_t>(kept),
+                                    [](candidate_ const &lhs, candidate_ const &rhs) { return lhs.gain > rhs.gain; });
+        candidates.resize(kept);
+        assign_(candidates);
+    }
+
+    void assign_(::std::vector<candidate_> &candidates) noexcept
+    {
+        ::std::ranges::sort(candidates, [](candidate_ const &lhs, candidate_ const &rhs) {
+            auto const lhs_first = lhs.symbol & 0xffu;
+            auto const rhs_first = rhs.symbol & 0xffu;
+
+            return lhs_first != rhs_first ? lhs_first < rhs_first : lhs.size > rhs.size;
+        });
+
+        count_ = candidates.size();
+        first_.fill(0u);
+
+        for (auto i = 0uz; i != count_; ++i)
+        {
+            symbols_[i] = candidates[i].symbol;
+            sizes_[i] = static_cast<unsigned char>(candidates[i].size);
+            ++first_[(candidates[i].symbol & 0xffu) + 1uz];
+        }
+
+        for (auto i = 1uz; i != first_.size(); ++i)
+            first_[i] = static_cast<::std::uint16_t>(first_[i] + first_[i - 1uz]);
+    }
+
+  public:
+    static inline constexpr unsigned char escape{255u};
+    static inline constexpr ::std::size_t max_symbol_size{8uz};
+
+    /**
+     * @brief train() reads at most this many bytes of the sample
+     */
+    static inline constexpr ::std::size_t max_sample_size{1uz << 16};
+
+    /**
+     * @brief a table without symbols, which escapes every byte
+     */
+    symbol_table() noexcept = default;
+
+    /**
+     * @brief builds a table in 5 rounds of encoding the sample and keeping the most profitable symbols
+     * @param sample, strings resembling those which will be encoded, only the first max_sample_size bytes are read
+     */
+    template <::std::ranges::input_range R>
+        requires ::std::ranges::contiguous_range<::std::ranges::range_reference_t<R>> &&
+                 ::std::ranges::sized_range<::std::ranges::range_reference_t<R>>
+    static symbol_table train(R &&sample)
+    {
+        ::std::vector<::std::span<unsigned char const>> bytes;
+        auto budget = max_sample_size;
+
+        for (auto &&str : sample)
+        {
+            auto const span = detail::symbol_bytes_(str);
+
+            if (span.empty())
+                continue;
+
+            bytes.push_back(span.first(::std::ranges::min(span.size(), budget)));
+            budget -= bytes.back().size();
+
+            if (budget == 0uz)
+                break;
+        }
+
+        symbol_table table;
+
+        for (auto round = 0uz; round != 5uz; ++round)
+            table.train_round_(bytes);
+
+        return table;
+    }
+
+    /**
+     * @return number of symbols
+     */
+    ::std::size_t size() const noexcept
+    {
+        return count_;
+    }
+
+    /**
+     * @return number of bytes of the symbol of code
+     */
+    ::std::size_t symbol_size(unsigned char code) const noexcept
+    {
+        return sizes_[code];
+    }
+
+    /**
+     * @brief calls put with each byte of the encoding of [in, in + size) until put returns false
+     * @return false if put returned false
+     */
+    template <typename Put>
+    bool encode(unsigned char const *in, ::std::size_t size, Put put) const
+    {
+        for (auto i = 0uz; i != size;)
+        {
+            auto symbol_size = 0uz;
+            auto const code = match_(in + i, size - i, symbol_size);
+
+            if (!put(static_cast<unsigned char>(code)))
+                return false;
+
+            if (code == escape && !put(in[i]))
+                return false;
+
+            i += symbol_size;
+        }
+
+        return true;
+    }
+
+    /**
+     * @return an upper bound of the decoded size of size bytes of encoding, which is also the space decode() needs
+     */
+    static constexpr ::std::size_t decoded_bound(::std::size_t size) noexcept
+    {
+        return size * max_symbol_size;
+    }
+
+    /**
+     * @return decoded size of [in, in + size), which is computed from the codes without writing the bytes
+     */
+    ::std::size_t decoded_size(unsigned char const *in, ::std::size_t size) const noexcept
+    {
+        auto result = 0uz;
+
+        for (auto i = 0uz; i != size; ++i)
+        {
+            if (in[i] == escape)
+            {
+                ++i;
+                ++result;
+            }
+            else
+            {
+                result += sizes_[in[i]];
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief symbols are copied 8 bytes at a time, so out may be written past the decoded size, up to
+     * @brief decoded_bound(size)
+     * @param out, which has decoded_bound(size) bytes
+     * @return decoded size
+     */
+    ::std::size_t decode(unsigned char const *in, ::std::size_t size, unsigned char *out) const noexcept
+    {
+        auto const first = out;
+
+        for (auto i = 0uz; i != size; ++i)
+        {
+            auto const code = in[i];
+
+            if (code == escape)
+            {
+                *out++ = in[++i];
+            }
+            else
+            {
+                detail::store_symbol_(out, symbols_[code]);
+                out += sizes_[code];
+            }
+        }
+
+        return static_cast<::std::size_t>(out - first);
+    }
+};
+
+/**
+ * @brief a sequence of strings compressed with a shared symbol_table, the bytes of the characters are encoded, and
+ * @brief the i-th element is [offsets()[i], offsets()[i + 1]) of bytes()
+ * @brief elements are decoded one at a time into a string supplied by the caller, so a scan can reuse one buffer
+ * @brief columns constructed with the same table can compare their elements without decoding them
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>>
+class basic_compressed_string_column
+{
+  public:
+    using value_type = ::std::basic_string_view<CharT, Traits>;
+    using string_type = basic_string<CharT, Traits>;
+    using size_type = ::std::size_t;
+
+  private:
+    ::std::shared_ptr<symbol_table const> symbols_;
+    ::std::vector<unsigned char> bytes_;
+
+    /**
+     * @brief size() + 1 offsets, the first is always 0
+     */
+    ::std::vector<size_type> offsets_{0uz};
+    size_type chars_size_{};
+
+  public:
+    basic_compressed_string_column() : symbols_(::std::make_shared<symbol_table const>())
+    {
+    }
+
+    /**
+     * @param symbols, which is shared with other columns, and must not be null
+     */
+    explicit basic_compressed_string_column(::std::shared_ptr<symbol_table const> symbols) noexcept
+        : symbols_(::std::move(symbols))
+    {
+    }
+
+    /**
+     * @brief trains a table on elements spread evenly over rg, then compresses every element
+     */
+    template <::std::ranges::forward_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type> &&
+                 (!::std::same_as<::std::remove_cvref_t<R>, basic_compressed_string_column>)
+    explicit basic_compressed_string_column(R &&rg)
+    {
+        auto count = 0uz;
+        auto chars = 0uz;
+
+        for (value_type const str : rg)
+        {
+            ++count;
+            chars += str.size();
+        }
+
+        auto const step = ::std::ranges::max(chars * sizeof(CharT) / symbol_table::max_sample_size, 1uz);
+        ::std::vector<value_type> sample;
+        sample.reserve(count / step + 1uz);
+        auto i = 0uz;
+
+        for (value_type const str : rg)
+        {
+            if (i++ % step == 0uz)
+                sample.push_back(str);
+        }
+
+        symbols_ = ::std::make_shared<symbol_table const>(symbol_table::train(sample));
+        offsets_.reserve(count + 1uz);
+        append_range(::std::forward<R>(rg));
+    }
+
+    ::std::shared_ptr<symbol_table const> const &symbols() const noexcept
+    {
+        return symbols_;
+    }
+
+    size_type size() const noexcept
+    {
+        return offsets_.size() - 1uz;
+    }
+
+    bool empty() const noexcept
+    {
+        return offsets_.size() == 1uz;
+    }
+
+    /**
+     * @return total number of characters of the elements
+     */
+    size_type chars_size() const noexcept
+    {
+        return chars_size_;
+    }
+
+    /**
+     * @return total number of bytes of the encoded elements
+     */
+    size_type compressed_size() const noexcept
+    {
+        return bytes_.size();
+    }
+
+    ::std::span<unsigned char const> bytes() const noexcept
+    {
+        return bytes_;
+    }
+
+    /**
+     * @return size() + 1 offsets into bytes(), the first is 0 and the last is compressed_size()
+     */
+    ::std::span<size_type const> offsets() const noexcept
+    {
+        return offsets_;
+    }
+
+    /**
+     * @param count, number of elements
+     * @param bytes, total number of bytes of the encoded elements
+     */
+    void reserve(size_type count, size_type bytes)
+    {
+        offsets_.reserve(count + 1uz);
+        bytes_.reserve(bytes);
+    }
+
+    void clear() noexcept
+    {
+        bytes_.clear();
+        offsets_.resize(1uz);
+        chars_size_ = 0uz;
+    }
+
+    void push_back(value_type str)
+    {
+        // the push_back of the offset cannot throw after str is encoded, the capacity grows geometrically
+        if (offsets_.size() == offsets_.capacity())
+            offsets_.reserve(::std::ranges::max(offsets_.capacity() * 2uz, offsets_.size() + 1uz));
+
+        auto const bytes = detail::symbol_bytes_(str);
+        symbols_->encode(bytes.data(), bytes.size(), [this](unsigned char byte) {
+            bytes_.push_back(byte);
+
+            return true;
+        });
+        offsets_.push_back(bytes_.size());
+        chars_size_ += str.size();
+    }
+
+    void pop_back() noexcept
+    {
+        auto const in = compressed(size() - 1uz);
+        chars_size_ -= symbols_->decoded_size(in.data(), in.size()) / sizeof(CharT);
+        offsets_.pop_back();
+        bytes_.resize(offsets_.back());
+    }
+
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type>
+    void append_range(R &&rg)
+    {
+        for (value_type const str : rg)
+            push_back(str);
+    }
+
+    /**
+     * @return the encoded bytes of the element at pos
+     */
+    ::std::span<unsigned char const> compressed(size_type pos) const noexcept
+    {
+        return ::std::span<unsigned char const>(bytes_).subspan(offsets_[pos], offsets_[pos + 1uz] - offsets_[pos]);
+    }
+
+    /**
+     * @brief replaces the contents of out with the element at pos, out is written in place, so its capacity is
+     * @brief reused when a scan decodes into the same string
+     */
+    template <typename Allocator>
+    void decode(size_type pos, basic_string<CharT, Traits, Allocator> &out) const
+    {
+        auto const in = compressed(pos);
+        auto const bound = symbol_table::decoded_bound(in.size());
+
+        out.resize_and_overwrite((bound + sizeof(CharT) - 1uz) / sizeof(CharT), [&](CharT *data, ::std::size_t) {
+            return symbols_->decode(in.data(), in.size(), reinterpret_cast<unsigned char *>(data)) / sizeof(CharT);
+        });
+    }
+
+    string_type operator[](size_type pos) const
+    {
+        string_type str;
+        decode(pos, str);
+
+        return str;
+    }
+
+    string_type at(size_type pos) const
+    {
+        if (pos >= size())
+            throw ::std::out_of_range("pos is out of range, please check it.");
+
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief compares the encoded bytes, no element is decoded
+     */
+    bool equal(size_type lhs, size_type rhs) const noexcept
+    {
+        return ::std::ranges::equal(compressed(lhs), compressed(rhs));
+    }
+
+    /**
+     * @brief str is encoded and compared with the encoded bytes of the element at pos as it is produced, so the
+     * @brief comparison stops at the first mismatch and nothing is allocated
+     */
+    bool equal(size_type pos, value_type str) const
+    {
+        auto const in = compressed(pos);
+        auto const bytes = detail::symbol_bytes_(str);
+        auto i = 0uz;
+
+        return symbols_->encode(bytes.data(), bytes.size(),
+                                [&](unsigned char byte) { return i != in.size() && in[i++] == byte; }) &&
+               i == in.size();
+    }
+
+    ::std::vector<string_type> to_vector() const
+    {
+        ::std::vector<string_type> result(size());
+
+        for (auto i = 0uz; i != result.size(); ++i)
+            decode(i, result[i]);
+
+        return result;
+    }
+
+    /**
+     * @brief columns sharing a table compare encoded bytes, other columns compare decoded elements
+     */
+    friend bool operator==(basic_compressed_string_column const &lhs, basic_compressed_string_column const &rhs)
+    {
+        if (lhs.symbols_ == rhs.symbols_)
+            return lhs.offsets_ == rhs.offsets_ && lhs.bytes_ == rhs.bytes_;
+
+        if (lhs.size() != rhs.size() || lhs.chars_size_ != rhs.chars_size_)
+            return false;
+
+        string_type lhs_str;
+        string_type rhs_str;
+
+        for (auto i = 0uz; i != lhs.size(); ++i)
+        {
+            lhs.decode(i, lhs_str);
+            rhs.decode(i, rhs_str);
+
+            if (lhs_str != rhs_str)
+                return false;
+        }
+
+        return true;
+    }
+};
+
+using compressed_string_column = basic_compressed_string_column<char>;
+using wcompressed_string_column = basic_compressed_string_column<wchar_t>;
+using u8compressed_string_column = basic_compressed_string_column<char8_t>;
+using u16compressed_string_column = basic_compressed_string_column<char16_t>;
+using u32compressed_string_column = basic_compressed_string_column<char32_t>;
+} // namespace bizwen
+
+#endif
@@ -0,0 +1,304 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_CONCURRENT_STRING_POOL_HPP)
+#define BIZWEN_CONCURRENT_STRING_POOL_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+#include "string_pool.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a string pool which can be used by many threads at once
+ * @brief the strings are distributed to shards by hash, every shard has an open addressing table, an arena and a
+ * @brief mutex which serializes its writers, lookups never take the mutex and finish in a bounded number of steps
+ * @brief a table is never modified after it is replaced by a larger one, so lookups can still read it, the
+ * @brief replaced tables are kept until the pool is destroyed, which costs at most as much as the current tables
+ * @brief the id of a string encodes its shard and its index in the shard, so ids are not consecutive
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>>
+class basic_concurrent_string_pool
+{
+    using view_type_ = ::std::basic_string_view<CharT, Traits>;
+
+    struct entry_
+    {
+        ::std::size_t hash;
+        view_type_ str;
+        ::std::uint32_t id;
+    };
+
+    /**
+     * @brief at most half of the slots are used, so a probe always reaches an empty slot
+     */
+    struct table_
+    {
+        ::std::size_t mask;
+        ::std::unique_ptr<::std::atomic<entry_ const *>[]> slots;
+    };
+
+    static inline constexpr ::std::size_t max_shards_{256uz};
+    static inline constexpr ::std::size_t first_table_size_{16uz};
+
+    /**
+     * @brief entries are stored in segments of doubling size, so they never move and the segment of an index is
+     * @brief computed rather than looked up in an array which would have to grow
+     */
+    static inline constexpr ::std::size_t first_segment_size_{64uz};
+    static inline constexpr ::std::size_t segment_count_{::std::numeric_limits<::std::uint32_t>::digits};
+
+    struct alignas(64) shard_
+    {
+        // read by lookups
+        ::std::atomic<table_ const *> table{};
+        ::std::array<::std::atomic<entry_ const *>, segment_count_> segments{};
+        ::std::atomic<::std::size_t> size{};
+
+        // owned by the writer holding the mutex
+        ::std::mutex mutex;
+        ::std::vector<::std::unique_ptr<table_>> tables;
+        ::std::array<::std::unique_ptr<entry_[]>, segment_count_> segment_owners;
+        detail::string_arena_<CharT, Traits> arena{0uz};
+    };
+
+    ::std::size_t shard_bits_{};
+    ::std::unique_ptr<shard_[]> shards_;
+
+    static ::std::size_t hash_(view_type_ str) noexcept
+    {
+        return ::std::hash<::std::basic_string_view<CharT>>{}(::std::basic_string_view<CharT>(str.data(), str.size()));
+    }
+
+    /**
+     * @brief the tables use the low bits of the hash, so the shard is selected by the high bits
+     */
+    shard_ &shard_of_(::std::size_t hash) const noexcept
+    {
+        if (shard_bits_ == 0uz)
+            return shards_[0];
+
+        return shards_[hash >> (::std::numeric_limits<::std::size_t>::digits - shard_bits_)];
+    }
+
+    /**
+     * @return segment and offset in the segment of the entry at index
+     */
+    static ::std::pair<::std::size_t, ::std::size_t> locate_(::std::size_t index) noexcept
+    {
+        auto const segment = static_cast<::std::size_t>(::std::bit_width(index / first_segment_size_ + 1uz)) - 1uz;
+
+        return {segment, index - first_segment_size_ * ((1uz << segment) - 1uz)};
+    }
+
+    static table_ *new_table_(shard_ &shard, ::std::size_t size)
+    {
+        shard.tables.push_back(::std::make_unique<table_>(
+            size - 1uz, ::std::make_unique<::std::atomic<entry_ const *>[]>(size)));
+
+        return shard.tables.back().get();
+    }
+
+    static void insert_(table_ const &table, entry_ const *entry) noexcept
+    {
+        auto i = entry->hash & table.mask;
+
+        while (table.slots[i].load(::std::memory_order_relaxed) != nullptr)
+            i = (i + 1uz) & table.mask;
+
+        table.slots[i].store(entry, ::std::memory_order_release);
+    }
+
+    static entry_ const *find_(table_ const &table, view_type_ str, ::std::size_t hash) noexcept
+    {
+        for (auto i = hash & table.mask;; i = (i + 1uz) & table.mask)
+        {
+            auto const entry = table.slots[i].load(::std::memory_order_acquire);
+
+            if (entry == nullptr)
+                return nullptr;
+
+            if (entry->hash == hash && entry->str == str)
+                return entry;
+        }
+    }
+
+    /**
+     * @brief the entries are inserted into the new table before it is published, so it is complete when lookups
+     * @brief see it
+     */
+    static table_ const *grow_(shard_ &shard, ::std::size_t size)
+    {
+        auto const old_table = shard.table.load(::std::memory_order_relaxed);
+        auto const table = new_table_(shard, (old_table->mask + 1uz) * 2uz);
+
+        for (auto i = 0uz; i != size; ++i)
+        {
+            auto const [segment, offset] = locate_(i);
+            insert_(*table, &shard.segment_owners[segment][offset]);
+        }
+
+        shard.table.store(table, ::std::memory_order_release);
+
+        return table;
+    }
+
+  public:
+    using id_type = string_id;
+    using view_type = view_type_;
+
+    static inline constexpr ::std::size_t default_page_size{(1uz << 16) / sizeof(CharT)};
+
+    /**
+     * @param shards, which is rounded up to a power of two, at most 256
+     * @param page_size, number of characters of a page of the arena of each shard
+     */
+    explicit basic_concurrent_string_pool(::std::size_t shards = 64uz, ::std::size_t page_size = default_page_size)
+        : shard_bits_(
+              static_cast<::std::size_t>(::std::countr_zero(::std::bit_ceil(::std::clamp(shards, 1uz, max_shards_))))),
+          shards_(::std::make_unique<shard_[]>(1uz << shard_bits_))
+    {
+        for (auto i = 0uz; i != 1uz << shard_bits_; ++i)
+        {
+            auto &shard = shards_[i];
+            shard.arena = detail::string_arena_<CharT, Traits>(page_size);
+            shard.table.store(new_table_(shard, first_table_size_), ::std::memory_order_relaxed);
+        }
+    }
+
+    basic_concurrent_string_pool(basic_concurrent_string_pool const &) = delete;
+    basic_concurrent_string_pool &operator=(basic_concurrent_string_pool const &) = delete;
+
+    /**
+     * @brief thread safe, a string that is already interned is found without locking, only the writers of the same
+     * @brief shard wait for each other
+     * @return id of str, str is copied into the pool if it was not interned before
+     * @throw std::length_error if the shard of str is full
+     */
+    id_type intern(view_type str)
+    {
+        auto const hash = hash_(str);
+        auto &shard = shard_of_(hash);
+
+        if (auto const entry = find_(*shard.table.load(::std::memory_order_acquire), str, hash))
+            return id_type{entry->id};
+
+        ::std::lock_guard guard{shard.mutex};
+        auto table = shard.table.load(::std::memory_order_relaxed);
+
+        // another writer may have inserted str while this one was waiting
+        if (auto const entry = find_(*table, str, hash))
+            return id_type{entry->id};
+
+        auto const index = shard.size.load(::std::memory_order_relaxed);
+
+        if (index >= 1uz << (::std::numeric_limits<::std::uint32_t>::digits - shard_bits_))
+            throw ::std::length_error("too many strings in basic_concurrent_string_pool.");
+
+        auto const [segment, offset] = locate_(index);
+
+        if (offset == 0uz)
+        {
+            shard.segment_owners[segment] = ::std::make_unique<entry_[]>(first_segment_size_ << segment);
+            shard.segments[segment].store(shard.segment_owners[segment].get(), ::std::memory_order_release);
+        }
+
+        auto const shard_index = static_cast<::std::size_t>(&shard - shards_.get());
+        auto const id = static_cast<::std::uint32_t>(index << shard_bits_ | shard_index);
+        auto &entry = shard.segment_owners[segment][offset];
+        entry = {hash, shard.arena.store(str), id};
+
+        if ((index + 1uz) * 2uz > table->mask + 1uz)
+            table = grow_(shard, index);
+
+        insert_(*table, &entry);
+        shard.size.store(index + 1uz, ::std::memory_order_relaxed);
+
+        return id_type{id};
+    }
+
+    /**
+     * @brief thread safe and wait-free, a string interned concurrently may not be found
+     * @return id of str if it was interned, str is never inserted
+     */
+    ::std::optional<id_type> find(view_type str) const noexcept
+    {
+        auto const hash = hash_(str);
+
+        if (auto const entry = find_(*shard_of_(hash).table.load(::std::memory_order_acquire), str, hash))
+            return id_type{entry->id};
+
+        return ::std::nullopt;
+    }
+
+    bool contains(view_type str) const noexcept
+    {
+        return find(str).has_value();
+    }
+
+    /**
+     * @brief thread safe and wait-free
+     * @param id, which was returned by this pool to this thread, or passed to it with synchronization
+     */
+    view_type view(id_type id) const noexcept
+    {
+        auto const &shard = shards_[id.value() & ((1uz << shard_bits_) - 1uz)];
+        auto const [segment, offset] = locate_(id.value() >> shard_bits_);
+
+        return shard.segments[segment].load(::std::memory_order_acquire)[offset].str;
+    }
+
+    view_type operator[](id_type id) const noexcept
+    {
+        return view(id);
+    }
+
+    CharT const *c_str(id_type id) const noexcept
+    {
+        return view(id).data();
+    }
+
+    /**
+     * @return number of distinct strings, which may be outdated when it returns if other threads are interning
+     */
+    ::std::size_t size() const noexcept
+    {
+        auto size = 0uz;
+
+        for (auto i = 0uz; i != 1uz << shard_bits_; ++i)
+            size += shards_[i].size.load(::std::memory_order_relaxed);
+
+        return size;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0uz;
+    }
+};
+
+using concurrent_string_pool = basic_concurrent_string_pool<char>;
+using wconcurrent_string_pool = basic_concurrent_string_pool<wchar_t>;
+using u8concurrent_string_pool = basic_concurrent_string_pool<char8_t>;
+using u16concurrent_string_pool = basic_concurrent_string_pool<char16_t>;
+using u32concurrent_string_pool = basic_concurrent_string_pool<char32_t>;
+} // namespace bizwen
+
+#endif
@@ -0,0 +1,257 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_DICTIONARY_COLUMN_HPP)
+#define BIZWEN_DICTIONARY_COLUMN_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+#include "string_pool.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a sequence of strings stored as codes into a dictionary, which holds every distinct value once
+ * @brief a code is the id of the value in the dictionary, so codes are assigned in the order values are first seen,
+ * @brief equal codes mean equal values but the order of codes is not the order of values
+ * @brief columns constructed with the same dictionary share it, and their codes can be compared with each other
+ * @brief Code can be narrower than 32 bits for columns with few distinct values
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>, ::std::unsigned_integral Code = ::std::uint32_t>
+class basic_dictionary_column
+{
+  public:
+    using value_type = ::std::basic_string_view<CharT, Traits>;
+    using code_type = Code;
+    using dictionary_type = basic_string_pool<CharT, Traits>;
+    using size_type = ::std::size_t;
+
+  private:
+    ::std::shared_ptr<dictionary_type> dictionary_;
+    ::std::vector<Code> codes_;
+
+  public:
+    basic_dictionary_column() : dictionary_(::std::make_shared<dictionary_type>())
+    {
+    }
+
+    /**
+     * @param dictionary, which is shared with other columns, and must not be null
+     */
+    explicit basic_dictionary_column(::std::shared_ptr<dictionary_type> dictionary) noexcept
+        : dictionary_(::std::move(dictionary))
+    {
+    }
+
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type> &&
+                 (!::std::same_as<::std::remove_cvref_t<R>, basic_dictionary_column>)
+    explicit basic_dictionary_column(R &&rg) : basic_dictionary_column()
+    {
+        append_range(::std::forward<R>(rg));
+    }
+
+    ::std::shared_ptr<dictionary_type> const &dictionary() const noexcept
+    {
+        return dictionary_;
+    }
+
+    /**
+     * @return code of str, str is added to the dictionary if it is not there
+     * @throw std::length_error if the dictionary has more values than Code can represent
+     */
+    code_type encode(value_type str)
+    {
+        constexpr auto code_max = static_cast<::std::size_t>(::std::numeric_limits<Code>::max());
+
+        // a new value gets the id size(), which is checked before the shared dictionary is modified
+        if (dictionary_->size() > code_max && !dictionary_->contains(str))
+            throw ::std::length_error("too many distinct values for the code type of basic_dictionary_column.");
+
+        auto const id = dictionary_->intern(str).value();
+
+        // a value interned through a column with a wider code type
+        if (id > code_max)
+            throw ::std::length_error("too many distinct values for the code type of basic_dictionary_column.");
+
+        return static_cast<Code>(id);
+    }
+
+    /**
+     * @return code of str if it is in the dictionary, the dictionary is not modified
+     */
+    ::std::optional<code_type> find_code(value_type str) const
+    {
+        if (auto const id = dictionary_->find(str); id && id->value() <= ::std::numeric_limits<Code>::max())
+            return static_cast<Code>(id->value());
+
+        return ::std::nullopt;
+    }
+
+    value_type decode(code_type code) const noexcept
+    {
+        return dictionary_->view(string_id{code});
+    }
+
+    size_type size() const noexcept
+    {
+        return codes_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return codes_.empty();
+    }
+
+    void reserve(size_type count)
+    {
+        codes_.reserve(count);
+    }
+
+    void clear() noexcept
+    {
+        codes_.clear();
+    }
+
+    void push_back(value_type str)
+    {
+        auto const code = encode(str);
+        codes_.push_back(code);
+    }
+
+    /**
+     * @param code, which was returned by encode() of a column sharing the dictionary
+     */
+    void push_back_code(code_type code)
+    {
+        codes_.push_back(code);
+    }
+
+    void pop_back() noexcept
+    {
+        codes_.pop_back();
+    }
+
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type>
+    void append_range(R &&rg)
+    {
+        if constexpr (::std::ranges::sized_range<R>)
+        {
+            auto const size = codes_.size() + ::std::ranges::size(rg);
+
+            // at least doubles, so appending many small ranges is linear
+            if (size > codes_.capacity())
+                codes_.reserve(::std::ranges::max(size, codes_.capacity() * 2uz));
+        }
+
+        for (value_type const str : rg)
+            push_back(str);
+    }
+
+    value_type operator[](size_type pos) const noexcept
+    {
+        return decode(codes_[pos]);
+    }
+
+    value_type at(size_type pos) const
+    {
+        if (pos >= codes_.size())
+            throw ::std::out_of_range("pos is out of range, please check it.");
+
+        return decode(codes_[pos]);
+    }
+
+    code_type code(size_type pos) const noexcept
+    {
+        return codes_[pos];
+    }
+
+    ::std::span<Code const> codes() const noexcept
+    {
+        return codes_;
+    }
+
+    /**
+     * @return a random access view of the values, which is invalidated by modifications of the column
+     */
+    auto values() const noexcept
+    {
+        return ::std::views::transform(codes_, [this](Code code) noexcept { return decode(code); });
+    }
+
+    /**
+     * @brief str is encoded once and the codes are compared, so no characters are compared
+     */
+    size_type count(value_type str) const
+    {
+        auto const code = find_code(str);
+
+        return code ? static_cast<size_type>(::std::ranges::count(codes_, *code)) : 0uz;
+    }
+
+    /**
+     * @return positions of the elements equal to str in ascending order
+     */
+    ::std::vector<size_type> find_all(value_type str) const
+    {
+        ::std::vector<size_type> positions;
+
+        if (auto const code = find_code(str))
+        {
+            for (auto i = 0uz; i != codes_.size(); ++i)
+            {
+                if (codes_[i] == *code)
+                    positions.push_back(i);
+            }
+        }
+
+        return positions;
+    }
+
+    ::std::vector<basic_string<CharT, Traits>> to_vector() const
+    {
+        ::std::vector<basic_string<CharT, Traits>> result;
+        result.reserve(codes_.size());
+
+        for (auto const code : codes_)
+            result.emplace_back(decode(code));
+
+        return result;
+    }
+
+    /**
+     * @brief columns sharing a dictionary compare codes, other columns compare values
+     */
+    friend bool operator==(basic_dictionary_column const &lhs, basic_dictionary_column const &rhs)
+    {
+        if (lhs.dictionary_ == rhs.dictionary_)
+            return lhs.codes_ == rhs.codes_;
+
+        return ::std::ranges::equal(lhs.values(), rhs.values());
+    }
+};
+
+using dictionary_column = basic_dictionary_column<char>;
+using wdictionary_column = basic_dictionary_column<wchar_t>;
+using u8dictionary_column = basic_dictionary_column<char8_t>;
+using u16dictionary_column = basic_dictionary_column<char16_t>;
+using u32dictionary_column = basic_dictionary_column<char32_t>;
+} // namespace bizwen
+
+#endif
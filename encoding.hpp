@@ -0,0 +1,1045 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_ENCODING_HPP)
+#define BIZWEN_ENCODING_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace bizwen
+{
+/**
+ * @brief standard is RFC 4648 section 4 with padding, url is section 5 without padding
+ */
+enum class base64_alphabet : unsigned char
+{
+    standard,
+    url
+};
+
+enum class hex_case : unsigned char
+{
+    lower,
+    upper
+};
+
+/**
+ * @brief a set of ASCII characters which append_percent_encoded copies unchanged, every other byte is encoded
+ */
+class percent_charset
+{
+    ::std::array<unsigned char, 16uz> rows_{};
+
+  public:
+    constexpr percent_charset() noexcept = default;
+
+    /**
+     * @brief characters that are not ASCII are ignored
+     */
+    constexpr explicit percent_charset(::std::string_view chars) noexcept
+    {
+        for (auto const ch : chars)
+        {
+            auto const byte = static_cast<unsigned char>(ch);
+
+            if (byte < 0x80u)
+                rows_[byte & 0x0fu] |= static_cast<unsigned char>(1u << (byte >> 4));
+        }
+    }
+
+    constexpr bool contains(char ch) const noexcept
+    {
+        auto const byte = static_cast<unsigned char>(ch);
+
+        return byte < 0x80u && (rows_[byte & 0x0fu] >> (byte >> 4) & 1u) != 0u;
+    }
+
+    /**
+     * @brief the bitmap of the vectorized scan, bit h of rows()[l] is set if the character h * 16 + l is in the set
+     */
+    constexpr ::std::array<unsigned char, 16uz> const &rows() const noexcept
+    {
+        return rows_;
+    }
+
+    friend constexpr percent_charset operator|(percent_charset lhs, percent_charset rhs) noexcept
+    {
+        for (auto i = 0uz; i != lhs.rows_.size(); ++i)
+            lhs.rows_[i] |= rhs.rows_[i];
+
+        return lhs;
+    }
+
+    /**
+     * @brief ALPHA, DIGIT, '-', '.', '_' and '~', see RFC 3986 section 2.3
+     */
+    static constexpr percent_charset unreserved() noexcept
+    {
+        return percent_charset{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~"};
+    }
+
+    /**
+     * @brief the unreserved characters, sub-delims, ':', '@' and '/', which may appear in a path unencoded
+     */
+    static constexpr percent_charset path() noexcept
+    {
+        return unreserved() | percent_charset{"!$&'()*+,;=:@/"};
+    }
+};
+
+namespace detail
+{
+inline constexpr ::std::array<char const *, 2uz> base64_chars_{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"};
+
+inline constexpr ::std::array<char const *, 2uz> hex_digits_{"0123456789abcdef", "0123456789ABCDEF"};
+
+/**
+ * @brief maps characters to their values, 0xff for characters that are not digits
+ */
+inline constexpr ::std::array<unsigned char, 256uz> make_digit_values_(char const *digits, ::std::size_t count) noexcept
+{
+    ::std::array<unsigned char, 256uz> values{};
+    values.fill(0xffu);
+
+    for (auto i = 0uz; i != count; ++i)
+        values[static_cast<unsigned char>(digits[i])] = static_cast<unsigned char>(i);
+
+    return values;
+}
+
+inline constexpr ::std::array<::std::array<unsigned char, 256uz>, 2uz> base64_values_{
+    make_digit_values_(base64_chars_[0], 64uz), make_digit_values_(base64_chars_[1], 64uz)};
+
+inline constexpr ::std::array<unsigned char, 256uz> hex_values_{[] {
+    auto values = make_digit_values_(hex_digits_[0], 16uz);
+
+    for (auto i = 10uz; i != 16uz; ++i)
+        values[static_cast<unsigned char>(hex_digits_[1][i])] = static_cast<unsigned char>(i);
+
+    return values;
+}()};
+
+constexpr ::std::size_t base64_encoded_size_(::std::size_t size, base64_alphabet alphabet) noexcept
+{
+    auto const rem = size % 3uz;
+
+    if (alphabet == base64_alphabet::standard)
+        return (size / 3uz + (rem != 0uz)) * 4uz;
+
+    return size / 3uz * 4uz + (rem != 0uz ? rem + 1uz : 0uz);
+}
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+/**
+ * @brief the value of the 6 bits is added to the entry of shift table selected by the range of the value
+ * @brief 0: 'a' - 26, 1 - 10: '0' - 52, 11: 62, 12: 63, 13: 'A'
+ */
+inline constexpr ::std::array<::std::array<unsigned char, 16uz>, 2uz> base64_shift_{
+    ::std::array<unsigned char, 16uz>{71u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u,
+                                      static_cast<unsigned char>('+' - 62), static_cast<unsigned char>('/' - 63), 65u,
+                                      0u, 0u},
+    ::std::array<unsigned char, 16uz>{71u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u, 252u,
+                                      static_cast<unsigned char>('-' - 62), static_cast<unsigned char>('_' - 63), 65u,
+                                      0u, 0u}};
+
+/**
+ * @brief spreads the 3 bytes of each group to 4 bytes, the middle bytes are repeated so both halves have 12 bits
+ */
+inline constexpr ::std::array<unsigned char, 16uz> base64_spread_{1u, 0u, 2u, 1u, 4u, 3u, 5u, 4u,
+                                                                  7u, 6u, 8u, 7u, 10u, 9u, 11u, 10u};
+
+/**
+ * @brief gathers the 3 bytes of each 32-bit group in big endian order
+ */
+inline constexpr ::std::array<unsigned char, 16uz> base64_gather_{2u,  1u,  0u,  6u,  5u,    4u,    10u,   9u,
+                                                                  8u,  14u, 13u, 12u, 0x80u, 0x80u, 0x80u, 0x80u};
+
+#if defined(__AVX2__)
+struct codec_block_
+{
+    using reg = __m256i;
+
+    static inline constexpr ::std::size_t size{32uz};
+
+    /**
+     * @brief number of readable bytes load_triplets needs
+     */
+    static inline constexpr ::std::size_t triplets_load_size{28uz};
+
+    static reg load(unsigned char const *p) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+    }
+
+    static void store(unsigned char *p, reg v) noexcept
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+    }
+
+    static reg table(::std::array<unsigned char, 16uz> const &t) noexcept
+    {
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(t.data())));
+    }
+
+    static reg broadcast(unsigned char ch) noexcept
+    {
+        return _mm256_set1_epi8(static_cast<char>(ch));
+    }
+
+    static reg broadcast32(::std::uint32_t v) noexcept
+    {
+        return _mm256_set1_epi32(static_cast<int>(v));
+    }
+
+    static reg lookup(reg table, reg index) noexcept
+    {
+        return _mm256_shuffle_epi8(table, index);
+    }
+
+    static reg bit_and(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+
+    static reg bit_or(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+
+    static reg add(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_add_epi8(lhs, rhs);
+    }
+
+    static reg sub(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_sub_epi8(lhs, rhs);
+    }
+
+    static reg subs(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_subs_epu8(lhs, rhs);
+    }
+
+    static reg equal(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_cmpeq_epi8(lhs, rhs);
+    }
+
+    /**
+     * @brief unsigned lhs < bound
+     */
+    static reg less(reg lhs, unsigned char bound) noexcept
+    {
+        return _mm256_cmpeq_epi8(_mm256_min_epu8(lhs, broadcast(bound - 1u)), lhs);
+    }
+
+    static reg high_nibble(reg v) noexcept
+    {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), broadcast(0x0fu));
+    }
+
+    static reg low_nibble(reg v) noexcept
+    {
+        return _mm256_and_si256(v, broadcast(0x0fu));
+    }
+
+    static reg mulhi(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_mulhi_epu16(lhs, rhs);
+    }
+
+    static reg mullo(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_mullo_epi16(lhs, rhs);
+    }
+
+    static reg maddubs(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_maddubs_epi16(lhs, rhs);
+    }
+
+    static reg madd(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_madd_epi16(lhs, rhs);
+    }
+
+    static bool all(reg v) noexcept
+    {
+        return _mm256_movemask_epi8(v) == -1;
+    }
+
+    static ::std::uint32_t mask(reg v) noexcept
+    {
+        return static_cast<::std::uint32_t>(_mm256_movemask_epi8(v));
+    }
+
+    /**
+     * @brief loads 12 bytes into each 128-bit lane
+     */
+    static reg load_triplets(unsigned char const *p) noexcept
+    {
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p))),
+                                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 12)), 1);
+    }
+
+    /**
+     * @brief stores the first 12 bytes of each 128-bit lane contiguously, 32 bytes are written
+     */
+    static void store_triplets(unsigned char *p, reg v) noexcept
+    {
+        store(p, _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7)));
+    }
+
+    /**
+     * @brief stores hi[0], lo[0], hi[1], lo[1]...
+     */
+    static void store_interleaved(unsigned char *p, reg hi, reg lo) noexcept
+    {
+        auto const first = _mm256_unpacklo_epi8(hi, lo);
+        auto const second = _mm256_unpackhi_epi8(hi, lo);
+        store(p, _mm256_permute2x128_si256(first, second, 0x20));
+        store(p + 32, _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    /**
+     * @brief narrows the 16-bit words to bytes and stores them, 16 bytes are written
+     */
+    static void store_words(unsigned char *p, reg v) noexcept
+    {
+        auto const packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(v, v), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_castsi256_si128(packed));
+    }
+};
+#else
+struct codec_block_
+{
+    using reg = __m128i;
+
+    static inline constexpr ::std::size_t size{16uz};
+    static inline constexpr ::std::size_t triplets_load_size{16uz};
+
+    static reg load(unsigned char const *p) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+    }
+
+    static void store(unsigned char *p, reg v) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+    }
+
+    static reg table(::std::array<unsigned char, 16uz> const &t) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(t.data()));
+    }
+
+    static reg broadcast(unsigned char ch) noexcept
+    {
+        return _mm_set1_epi8(static_cast<char>(ch));
+    }
+
+    static reg broadcast32(::std::uint32_t v) noexcept
+    {
+        return _mm_set1_epi32(static_cast<int>(v));
+    }
+
+    static reg lookup(reg table, reg index) noexcept
+    {
+        return _mm_shuffle_epi8(table, index);
+    }
+
+    static reg bit_and(reg lhs, reg rhs) noexcept
+    {
+        return _mm_and_si128(lhs, rhs);
+    }
+
+    static reg bit_or(reg lhs, reg rhs) noexcept
+    {
+        return _mm_or_si128(lhs, rhs);
+    }
+
+    static reg add(reg lhs, reg rhs) noexcept
+    {
+        return _mm_add_epi8(lhs, rhs);
+    }
+
+    static reg sub(reg lhs, reg rhs) noexcept
+    {
+        return _mm_sub_epi8(lhs, rhs);
+    }
+
+    static reg subs(reg lhs, reg rhs) noexcept
+    {
+        return _mm_subs_epu8(lhs, rhs);
+    }
+
+    static reg equal(reg lhs, reg rhs) noexcept
+    {
+        return _mm_cmpeq_epi8(lhs, rhs);
+    }
+
+    static reg less(reg lhs, unsigned char bound) noexcept
+    {
+        return _mm_cmpeq_epi8(_mm_min_epu8(lhs, broadcast(bound - 1u)), lhs);
+    }
+
+    static reg high_nibble(reg v) noexcept
+    {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), broadcast(0x0fu));
+    }
+
+    static reg low_nibble(reg v) noexcept
+    {
+        return _mm_and_si128(v, broadcast(0x0fu));
+    }
+
+    static reg mulhi(reg lhs, reg rhs) noexcept
+    {
+        return _mm_mulhi_epu16(lhs, rhs);
+    }
+
+    static reg mullo(reg lhs, reg rhs) noexcept
+    {
+        return _mm_mullo_epi16(lhs, rhs);
+    }
+
+    static reg maddubs(reg lhs, reg rhs) noexcept
+    {
+        return _mm_maddubs_epi16(lhs, rhs);
+    }
+
+    static reg madd(reg lhs, reg rhs) noexcept
+    {
+        return _mm_madd_epi16(lhs, rhs);
+    }
+
+    static bool all(reg v) noexcept
+    {
+        return _mm_movemask_epi8(v) == 0xffff;
+    }
+
+    static ::std::uint32_t mask(reg v) noexcept
+    {
+        return static_cast<::std::uint32_t>(_mm_movemask_epi8(v));
+    }
+
+    static reg load_triplets(unsigned char const *p) noexcept
+    {
+        return load(p);
+    }
+
+    /**
+     * @brief stores the first 12 bytes, 16 bytes are written
+     */
+    static void store_triplets(unsigned char *p, reg v) noexcept
+    {
+        store(p, v);
+    }
+
+    static void store_interleaved(unsigned char *p, reg hi, reg lo) noexcept
+    {
+        store(p, _mm_unpacklo_epi8(hi, lo));
+        store(p + 16, _mm_unpackhi_epi8(hi, lo));
+    }
+
+    /**
+     * @brief narrows the 16-bit words to bytes and stores them, 8 bytes are written
+     */
+    static void store_words(unsigned char *p, reg v) noexcept
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm_packus_epi16(v, v));
+    }
+};
+#endif
+
+/**
+ * @brief encodes groups of 3 bytes with multiply-shift and a pshufb lookup, see Wojciech Mula and Daniel Lemire,
+ * @brief Faster Base64 Encoding and Decoding Using AVX2 Instructions
+ * @return number of bytes encoded, which is a multiple of 3
+ */
+inline ::std::size_t encode_base64_blocks_(unsigned char const *in, ::std::size_t size, unsigned char *out,
+                                           base64_alphabet alphabet) noexcept
+{
+    using block = codec_block_;
+
+    auto const spread = block::table(base64_spread_);
+    auto const shift = block::table(base64_shift_[static_cast<::std::size_t>(alphabet)]);
+    auto i = 0uz;
+
+    for (; size - i >= block::triplets_load_size; i += block::size / 4uz * 3uz, out += block::size)
+    {
+        auto const v = block::lookup(block::load_triplets(in + i), spread);
+        auto const high = block::mulhi(block::bit_and(v, block::broadcast32(0x0fc0fc00u)), block::broadcast32(0x04000040u));
+        auto const low = block::mullo(block::bit_and(v, block::broadcast32(0x003f03f0u)), block::broadcast32(0x01000010u));
+        auto const indices = block::bit_or(high, low);
+        // 0 - 25 -> 13, 26 - 51 -> 0, 52 - 61 -> 1 - 10, 62 -> 11, 63 -> 12
+        auto const range = block::bit_or(block::subs(indices, block::broadcast(51u)),
+                                         block::bit_and(block::less(indices, 26u), block::broadcast(13u)));
+        block::store(out, block::add(indices, block::lookup(shift, range)));
+    }
+
+    return i;
+}
+
+/**
+ * @brief stops before the first block containing a character outside the alphabet, which is left to the caller
+ * @return number of characters decoded, which is a multiple of 4
+ */
+inline ::std::size_t decode_base64_blocks_(unsigned char const *in, ::std::size_t size, unsigned char *out,
+                                           base64_alphabet alphabet) noexcept
+{
+    using block = codec_block_;
+
+    auto const chars = base64_chars_[static_cast<::std::size_t>(alphabet)];
+    auto const char_62 = block::broadcast(static_cast<unsigned char>(chars[62]));
+    auto const char_63 = block::broadcast(static_cast<unsigned char>(chars[63]));
+    auto const gather = block::table(base64_gather_);
+    auto i = 0uz;
+
+    // store_triplets writes a whole register, so the output must have room for it
+    for (; size - i >= block::size * 3uz / 2uz; i += block::size, out += block::size / 4uz * 3uz)
+    {
+        auto const v = block::load(in + i);
+        auto const upper = block::less(block::sub(v, block::broadcast('A')), 26u);
+        auto const lower = block::less(block::sub(v, block::broadcast('a')), 26u);
+        auto const digit = block::less(block::sub(v, block::broadcast('0')), 10u);
+        auto const is_62 = block::equal(v, char_62);
+        auto const is_63 = block::equal(v, char_63);
+
+        if (!block::all(block::bit_or(block::bit_or(upper, lower), block::bit_or(digit, block::bit_or(is_62, is_63)))))
+            break;
+
+        auto const values = block::bit_or(
+            block::bit_or(block::bit_and(upper, block::sub(v, block::broadcast('A'))),
+                          block::bit_and(lower, block::sub(v, block::broadcast('a' - 26)))),
+            block::bit_or(block::bit_and(digit, block::add(v, block::broadcast(52 - '0'))),
+                          block::bit_or(block::bit_and(is_62, block::broadcast(62u)),
+                                        block::bit_and(is_63, block::broadcast(63u)))));
+        // 4 x 6 bits -> 2 x 12 bits -> 24 bits
+        auto const words = block::maddubs(values, block::broadcast32(0x01400140u));
+        auto const triplets = block::madd(words, block::broadcast32(0x00011000u));
+        block::store_triplets(out, block::lookup(triplets, gather));
+    }
+
+    return i;
+}
+
+/**
+ * @return number of bytes encoded
+ */
+inline ::std::size_t encode_hex_blocks_(unsigned char const *in, ::std::size_t size, unsigned char *out,
+                                        hex_case letter_case) noexcept
+{
+    using block = codec_block_;
+
+    ::std::array<unsigned char, 16uz> digits{};
+
+    for (auto i = 0uz; i != digits.size(); ++i)
+        digits[i] = static_cast<unsigned char>(hex_digits_[static_cast<::std::size_t>(letter_case)][i]);
+
+    auto const table = block::table(digits);
+    auto i = 0uz;
+
+    for (; size - i >= block::size; i += block::size, out += block::size * 2uz)
+    {
+        auto const v = block::load(in + i);
+        block::store_interleaved(out, block::lookup(table, block::high_nibble(v)),
+                                 block::lookup(table, block::low_nibble(v)));
+    }
+
+    return i;
+}
+
+/**
+ * @brief stops before the first block containing a character that is not a hex digit
+ * @return number of characters decoded, which is even
+ */
+inline ::std::size_t decode_hex_blocks_(unsigned char const *in, ::std::size_t size, unsigned char *out) noexcept
+{
+    using block = codec_block_;
+
+    auto i = 0uz;
+
+    for (; size - i >= block::size; i += block::size, out += block::size / 2uz)
+    {
+        auto const v = block::load(in + i);
+        auto const lower = block::bit_or(v, block::broadcast(0x20u));
+        auto const digit = block::less(block::sub(v, block::broadcast('0')), 10u);
+        auto const letter = block::less(block::sub(lower, block::broadcast('a')), 6u);
+
+        if (!block::all(block::bit_or(digit, letter)))
+            break;
+
+        auto const values = block::bit_or(block::bit_and(digit, block::sub(v, block::broadcast('0'))),
+                                          block::bit_and(letter, block::sub(lower, block::broadcast('a' - 10))));
+        // high nibble * 16 + low nibble
+        block::store_words(out, block::maddubs(values, block::broadcast32(0x01100110u)));
+    }
+
+    return i;
+}
+#endif
+
+template <typename Out>
+constexpr void encode_base64_(char const *in, ::std::size_t size, Out *out, base64_alphabet alphabet) noexcept
+{
+    auto const chars = base64_chars_[static_cast<::std::size_t>(alphabet)];
+    auto const byte = [in](::std::size_t i) { return static_cast<::std::uint32_t>(static_cast<unsigned char>(in[i])); };
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        i = encode_base64_blocks_(reinterpret_cast<unsigned char const *>(in), size,
+                                  reinterpret_cast<unsigned char *>(out), alphabet);
+        out += i / 3uz * 4uz;
+    }
+#endif
+
+    for (; size - i >= 3uz; i += 3uz, out += 4)
+    {
+        auto const v = byte(i) << 16 | byte(i + 1uz) << 8 | byte(i + 2uz);
+        out[0] = static_cast<Out>(chars[v >> 18]);
+        out[1] = static_cast<Out>(chars[v >> 12 & 0x3fu]);
+        out[2] = static_cast<Out>(chars[v >> 6 & 0x3fu]);
+        out[3] = static_cast<Out>(chars[v & 0x3fu]);
+    }
+
+    auto const rem = size - i;
+
+    if (rem == 0uz)
+        return;
+
+    auto const v = byte(i) << 16 | (rem == 2uz ? byte(i + 1uz) << 8 : 0u);
+    *out++ = static_cast<Out>(chars[v >> 18]);
+    *out++ = static_cast<Out>(chars[v >> 12 & 0x3fu]);
+
+    if (rem == 2uz)
+        *out++ = static_cast<Out>(chars[v >> 6 & 0x3fu]);
+
+    if (alphabet == base64_alphabet::standard)
+    {
+        *out++ = static_cast<Out>('=');
+
+        if (rem == 1uz)
+            *out = static_cast<Out>('=');
+    }
+}
+
+/**
+ * @param size, without padding
+ * @return false if a character is outside the alphabet or the unused bits of the last character are not zero
+ */
+template <typename Out>
+constexpr bool decode_base64_(char const *in, ::std::size_t size, Out *out, base64_alphabet alphabet) noexcept
+{
+    auto const &values = base64_values_[static_cast<::std::size_t>(alphabet)];
+    auto const value = [&](::std::size_t i) {
+        return static_cast<::std::uint32_t>(values[static_cast<unsigned char>(in[i])]);
+    };
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        i = decode_base64_blocks_(reinterpret_cast<unsigned char const *>(in), size,
+                                  reinterpret_cast<unsigned char *>(out), alphabet);
+        out += i / 4uz * 3uz;
+    }
+#endif
+
+    for (; size - i >= 4uz; i += 4uz, out += 3)
+    {
+        auto const a = value(i);
+        auto const b = value(i + 1uz);
+        auto const c = value(i + 2uz);
+        auto const d = value(i + 3uz);
+
+        if ((a | b | c | d) > 0x3fu)
+            return false;
+
+        auto const v = a << 18 | b << 12 | c << 6 | d;
+        out[0] = static_cast<Out>(v >> 16);
+        out[1] = static_cast<Out>(v >> 8 & 0xffu);
+        out[2] = static_cast<Out>(v & 0xffu);
+    }
+
+    switch (size - i)
+    {
+    case 0uz:
+        return true;
+    case 2uz: {
+        auto const a = value(i);
+        auto const b = value(i + 1uz);
+
+        if ((a | b) > 0x3fu || (b & 0x0fu) != 0u)
+            return false;
+
+        out[0] = static_cast<Out>(a << 2 | b >> 4);
+
+        return true;
+    }
+    case 3uz: {
+        auto const a = value(i);
+        auto const b = value(i + 1uz);
+        auto const c = value(i + 2uz);
+
+        if ((a | b | c) > 0x3fu || (c & 0x03u) != 0u)
+            return false;
+
+        auto const v = a << 18 | b << 12 | c << 6;
+        out[0] = static_cast<Out>(v >> 16);
+        out[1] = static_cast<Out>(v >> 8 & 0xffu);
+
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+template <typename Out>
+constexpr void encode_hex_(char const *in, ::std::size_t size, Out *out, hex_case letter_case) noexcept
+{
+    auto const digits = hex_digits_[static_cast<::std::size_t>(letter_case)];
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        i = encode_hex_blocks_(reinterpret_cast<unsigned char const *>(in), size,
+                               reinterpret_cast<unsigned char *>(out), letter_case);
+        out += i * 2uz;
+    }
+#endif
+
+    for (; i != size; ++i, out += 2)
+    {
+        auto const byte = static_cast<unsigned char>(in[i]);
+        out[0] = static_cast<Out>(digits[byte >> 4]);
+        out[1] = static_cast<Out>(digits[byte & 0x0fu]);
+    }
+}
+
+/**
+ * @param size, which is even
+ */
+template <typename Out>
+constexpr bool decode_hex_(char const *in, ::std::size_t size, Out *out) noexcept
+{
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        i = decode_hex_blocks_(reinterpret_cast<unsigned char const *>(in), size,
+                               reinterpret_cast<unsigned char *>(out));
+        out += i / 2uz;
+    }
+#endif
+
+    for (; i != size; i += 2uz)
+    {
+        auto const high = hex_values_[static_cast<unsigned char>(in[i])];
+        auto const low = hex_values_[static_cast<unsigned char>(in[i + 1uz])];
+
+        if ((high | low) > 0x0fu)
+            return false;
+
+        *out++ = static_cast<Out>(high << 4 | low);
+    }
+
+    return true;
+}
+
+/**
+ * @brief selects bit h of a byte for the high nibble h, the bytes that are not ASCII select nothing
+ */
+inline constexpr ::std::array<unsigned char, 16uz> percent_bits_{1u, 2u, 4u, 8u, 16u, 32u, 64u, 128u,
+                                                                 0u, 0u, 0u, 0u, 0u,  0u,  0u,  0u};
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+/**
+ * @param rows, bits, the tables of the set and percent_bits_ loaded by codec_block_::table
+ * @return mask of the bytes of the block at in that are not in the set
+ */
+inline ::std::uint32_t percent_escape_mask_(unsigned char const *in, codec_block_::reg rows,
+                                            codec_block_::reg bits) noexcept
+{
+    using block = codec_block_;
+
+    auto const v = block::load(in);
+    auto const hit =
+        block::bit_and(block::lookup(rows, block::low_nibble(v)), block::lookup(bits, block::high_nibble(v)));
+
+    return block::mask(block::equal(hit, block::broadcast(0u)));
+}
+#endif
+
+constexpr ::std::size_t percent_encoded_size_(char const *in, ::std::size_t size, percent_charset charset) noexcept
+{
+    auto escaped = 0uz;
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        using block = codec_block_;
+
+        auto const rows = block::table(charset.rows());
+        auto const bits = block::table(percent_bits_);
+
+        for (; size - i >= block::size; i += block::size)
+            escaped += static_cast<::std::size_t>(
+                ::std::popcount(percent_escape_mask_(reinterpret_cast<unsigned char const *>(in + i), rows, bits)));
+    }
+#endif
+
+    for (; i != size; ++i)
+        escaped += !charset.contains(in[i]);
+
+    return size + escaped * 2uz;
+}
+
+/**
+ * @brief the runs between the bytes to encode are copied in bulk
+ */
+template <typename Out>
+constexpr void encode_percent_(char const *in, ::std::size_t size, Out *out, percent_charset charset,
+                               hex_case letter_case) noexcept
+{
+    auto const digits = hex_digits_[static_cast<::std::size_t>(letter_case)];
+    auto const escape = [&out, digits](char ch) noexcept {
+        auto const byte = static_cast<unsigned char>(ch);
+        out[0] = static_cast<Out>('%');
+        out[1] = static_cast<Out>(digits[byte >> 4]);
+        out[2] = static_cast<Out>(digits[byte & 0x0fu]);
+        out += 3;
+    };
+    auto i = 0uz;
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+    if !consteval
+    {
+        using block = codec_block_;
+
+        auto const rows = block::table(charset.rows());
+        auto const bits = block::table(percent_bits_);
+
+        while (size - i >= block::size)
+        {
+            auto const block_first = i;
+            auto const block_last = i + block::size;
+
+            for (auto mask = percent_escape_mask_(reinterpret_cast<unsigned char const *>(in + i), rows, bits);
+                 mask != 0u; mask &= mask - 1u)
+            {
+                auto const pos = block_first + static_cast<::std::size_t>(::std::countr_zero(mask));
+                out = ::std::ranges::copy(in + i, in + pos, out).out;
+                escape(in[pos]);
+                i = pos + 1uz;
+            }
+
+            out = ::std::ranges::copy(in + i, in + block_last, out).out;
+            i = block_last;
+        }
+    }
+#endif
+
+    for (; i != size; ++i)
+    {
+        if (charset.contains(in[i]))
+            *out++ = static_cast<Out>(in[i]);
+        else
+            escape(in[i]);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief appends the base64 encoding of data to out, the output is sized exactly and written in place
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr void append_base64(basic_string<CharT, Traits, Allocator> &out, ::std::string_view data,
+                                    base64_alphabet alphabet = base64_alphabet::standard)
+{
+    auto const old_size = out.size();
+    auto const new_size = old_size + detail::base64_encoded_size_(data.size(), alphabet);
+
+    out.resize_and_overwrite(new_size, [&](CharT *buffer, ::std::size_t) noexcept {
+        detail::encode_base64_(data.data(), data.size(), buffer + old_size, alphabet);
+
+        return new_size;
+    });
+}
+
+/**
+ * @brief appends the bytes decoded from text to out, padding is optional for both alphabets
+ * @return false if text is not valid base64, out is unchanged then
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr bool decode_base64(basic_string<CharT, Traits, Allocator> &out, ::std::string_view text,
+                                    base64_alphabet alphabet = base64_alphabet::standard)
+{
+    auto size = text.size();
+    auto padding = 0uz;
+
+    if (size % 4uz == 0uz)
+    {
+        for (; padding != 2uz && size != 0uz && text[size - 1uz] == '='; --size)
+            ++padding;
+    }
+
+    auto const rem = size % 4uz;
+
+    if (rem == 1uz || (padding != 0uz && rem + padding != 4uz))
+        return false;
+
+    auto const old_size = out.size();
+    auto const new_size = old_size + size / 4uz * 3uz + (rem != 0uz ? rem - 1uz : 0uz);
+    auto valid = false;
+
+    out.resize_and_overwrite(new_size, [&](CharT *buffer, ::std::size_t) noexcept {
+        valid = detail::decode_base64_(text.data(), size, buffer + old_size, alphabet);
+
+        return valid ? new_size : old_size;
+    });
+
+    return valid;
+}
+
+/**
+ * @brief appends two hex digits for every byte of data to out
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr void append_hex(basic_string<CharT, Traits, Allocator> &out, ::std::string_view data,
+                                 hex_case letter_case = hex_case::lower)
+{
+    auto const old_size = out.size();
+    auto const new_size = old_size + data.size() * 2uz;
+
+    out.resize_and_overwrite(new_size, [&](CharT *buffer, ::std::size_t) noexcept {
+        detail::encode_hex_(data.data(), data.size(), buffer + old_size, letter_case);
+
+        return new_size;
+    });
+}
+
+/**
+ * @brief appends the bytes decoded from text to out, both cases are accepted
+ * @return false if text has an odd length or a character that is not a hex digit, out is unchanged then
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr bool decode_hex(basic_string<CharT, Traits, Allocator> &out, ::std::string_view text)
+{
+    if (text.size() % 2uz != 0uz)
+        return false;
+
+    auto const old_size = out.size();
+    auto const new_size = old_size + text.size() / 2uz;
+    auto valid = false;
+
+    out.resize_and_overwrite(new_size, [&](CharT *buffer, ::std::size_t) noexcept {
+        valid = detail::decode_hex_(text.data(), text.size(), buffer + old_size);
+
+        return valid ? new_size : old_size;
+    });
+
+    return valid;
+}
+
+/**
+ * @brief appends data to out with every byte that is not in charset encoded as %XX, see RFC 3986 section 2.1
+ * @brief the output is sized exactly and written in place
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr void append_percent_encoded(basic_string<CharT, Traits, Allocator> &out, ::std::string_view data,
+                                             percent_charset charset = percent_charset::unreserved(),
+                                             hex_case letter_case = hex_case::upper)
+{
+    auto const old_size = out.size();
+    auto const new_size = old_size + detail::percent_encoded_size_(data.data(), data.size(), charset);
+
+    out.resize_and_overwrite(new_size, [&](CharT *buffer, ::std::size_t) noexcept {
+        detail::encode_percent_(data.data(), data.size(), buffer + old_size, charset, letter_case);
+
+        return new_size;
+    });
+}
+
+/**
+ * @brief replaces every %XX in str with the byte it encodes in place, and '+' with ' ' if plus_as_space is set,
+ * @brief which is the encoding of HTML form data in query strings
+ * @brief malformed escapes are left unchanged, the result is never longer, so str is not reallocated
+ */
+template <typename CharT, typename Traits, typename Allocator>
+    requires(sizeof(CharT) == 1uz)
+inline constexpr void percent_decode(basic_string<CharT, Traits, Allocator> &str, bool plus_as_space = false)
+{
+    auto const begin = str.data();
+    auto const last = begin + str.size();
+    CharT const specials[]{CharT('%'), CharT('+')};
+    auto const specials_size = plus_as_space ? 2uz : 1uz;
+    auto const find = [&](CharT const *first) noexcept {
+        if !consteval
+        {
+            return detail::find_first_of_(first, last, specials, specials_size);
+        }
+
+        return ::std::ranges::find_first_of(first, last, specials, specials + specials_size);
+    };
+    CharT const *read = find(begin);
+    auto write = begin + (read - begin);
+
+    while (read != last)
+    {
+        if (*read == CharT('+'))
+        {
+            *write++ = CharT(' ');
+            ++read;
+        }
+        else if (last - read >= 3 && (detail::hex_values_[static_cast<unsigned char>(read[1])] |
+                                      detail::hex_values_[static_cast<unsigned char>(read[2])]) <= 0x0fu)
+        {
+            *write++ = static_cast<CharT>(detail::hex_values_[static_cast<unsigned char>(read[1])] << 4 |
+                                          detail::hex_values_[static_cast<unsigned char>(read[2])]);
+            read += 3;
+        }
+        else
+        {
+            *write++ = *read++;
+        }
+
+        auto const next = find(read);
+        write = ::std::ranges::copy(read, next, write).out;
+        read = next;
+    }
+
+    str.resize(static_cast<::std::size_t>(write - begin));
+}
+} // namespace bizwen
+
+#endif
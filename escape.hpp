@@ -0,0 +1,540 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_ESCAPE_HPP)
+#define BIZWEN_ESCAPE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string.hpp"
+#include "unicode.hpp"
+
+namespace bizwen
+{
+namespace detail
+{
+/**
+ * @brief reserves room for count more characters, growing the capacity by 1.5 at least, like push_back
+ */
+template <typename String>
+constexpr void grow_for_(String &str, ::std::size_t count)
+{
+    auto const size = str.size();
+    auto const cap = str.capacity();
+
+    if (cap - size < count)
+        str.reserve(::std::ranges::max(size + count, cap * 2uz - cap / 2uz));
+}
+
+template <typename CharT>
+struct char_special_
+{
+    CharT ch;
+
+    constexpr bool operator()(CharT c) const noexcept
+    {
+        return c == ch;
+    }
+
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+    simd_vec_<CharT> operator()(simd_vec_<CharT> v) const noexcept
+    {
+        return v == simd_vec_<CharT>::broadcast(ch);
+    }
+#endif
+};
+
+/**
+ * @brief control characters, '"' and '\\'
+ */
+template <typename CharT>
+struct json_special_
+{
+    constexpr bool operator()(CharT c) const noexcept
+    {
+        return static_cast<::std::make_unsigned_t<CharT>>(c) < 0x20u || c == CharT('"') || c == CharT('\\');
+    }
+
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+    simd_vec_<CharT> operator()(simd_vec_<CharT> v) const noexcept
+    {
+        using vec = simd_vec_<CharT>;
+
+        return (v < vec::broadcast(CharT(0x20))) | (v == vec::broadcast(CharT('"'))) |
+               (v == vec::broadcast(CharT('\\')));
+    }
+#endif
+};
+
+template <typename CharT>
+struct html_special_
+{
+    constexpr bool operator()(CharT c) const noexcept
+    {
+        return c == CharT('&') || c == CharT('<') || c == CharT('>') || c == CharT('"') || c == CharT('\'');
+    }
+
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+    simd_vec_<CharT> operator()(simd_vec_<CharT> v) const noexcept
+    {
+        using vec = simd_vec_<CharT>;
+
+        return (v == vec::broadcast(CharT('&'))) | (v == vec::broadcast(CharT('<'))) |
+               (v == vec::broadcast(CharT('>'))) | (v == vec::broadcast(CharT('"'))) |
+               (v == vec::broadcast(CharT('\'')));
+    }
+#endif
+};
+
+/**
+ * @brief the delimiter, '"', '\n' and '\r'
+ */
+template <typename CharT>
+struct csv_special_
+{
+    CharT delimiter;
+
+    constexpr bool operator()(CharT c) const noexcept
+    {
+        return c == delimiter || c == CharT('"') || c == CharT('\n') || c == CharT('\r');
+    }
+
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+    simd_vec_<CharT> operator()(simd_vec_<CharT> v) const noexcept
+    {
+        using vec = simd_vec_<CharT>;
+
+        return (v == vec::broadcast(delimiter)) | (v == vec::broadcast(CharT('"'))) |
+               (v == vec::broadcast(CharT('\n'))) | (v == vec::broadcast(CharT('\r')));
+    }
+#endif
+};
+
+/**
+ * @return a pointer to the first character in [first, last) for which special is true, or last
+ */
+template <typename CharT, typename Special>
+constexpr CharT const *find_special_(CharT const *first, CharT const *last, Special special) noexcept
+{
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+    if !consteval
+    {
+        using vec = simd_vec_<CharT>;
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            if (auto const mask = special(vec::load(first)).mask())
+                return first + first_lane_<CharT>(mask);
+        }
+    }
+#endif
+
+    for (; first != last && !special(*first); ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @return number of characters of the ASCII string s written to out
+ */
+template <typename CharT>
+constexpr ::std::size_t put_ascii_(char const *s, CharT *out) noexcept
+{
+    auto const begin = out;
+
+    for (; *s != '\0'; ++s)
+        *out++ = static_cast<CharT>(*s);
+
+    return static_cast<::std::size_t>(out - begin);
+}
+
+template <typename CharT>
+constexpr bool equal_ascii_(CharT const *first, CharT const *last, char const *s) noexcept
+{
+    for (; first != last && *s != '\0'; ++first, ++s)
+    {
+        if (*first != static_cast<CharT>(*s))
+            return false;
+    }
+
+    return first == last && *s == '\0';
+}
+
+/**
+ * @return value of the hex digit, or 16 if ch is not a hex digit
+ */
+template <typename CharT>
+constexpr unsigned hex_digit_(CharT ch) noexcept
+{
+    auto const c = static_cast<::std::make_unsigned_t<CharT>>(ch);
+
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if ((c | 0x20u) >= 'a' && (c | 0x20u) <= 'f')
+        return (c | 0x20u) - 'a' + 10u;
+
+    return 16u;
+}
+
+/**
+ * @brief appends the runs of in without specials in bulk, and escape(ch, buffer) for every special
+ */
+template <typename CharT, typename Traits, typename Allocator, typename Special, typename Escape>
+constexpr void append_escaped_(basic_string<CharT, Traits, Allocator> &out, ::std::basic_string_view<CharT, Traits> in,
+                               Special special, Escape escape)
+{
+    auto first = in.data();
+    auto const last = first + in.size();
+
+    grow_for_(out, in.size());
+
+    for (;;)
+    {
+        auto const next = find_special_(first, last, special);
+        out.append(first, static_cast<::std::size_t>(next - first));
+
+        if (next == last)
+            return;
+
+        ::std::array<CharT, 8uz> buffer{};
+        auto const length = escape(*next, buffer.data());
+        grow_for_(out, length + static_cast<::std::size_t>(last - next - 1));
+        out.append(buffer.data(), length);
+        first = next + 1;
+    }
+}
+} // namespace detail
+
+/**
+ * @brief appends str to out as the content of a JSON string, the quotes around it are not appended
+ * @brief '"', '\\' and control characters are escaped, other characters are copied unchanged
+ * @brief str must not refer to out
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr void append_json_escaped(basic_string<CharT, Traits, Allocator> &out,
+                                          ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> str)
+{
+    detail::append_escaped_(out, str, detail::json_special_<CharT>{}, [](CharT ch, CharT *buffer) noexcept {
+        switch (ch)
+        {
+        case CharT('"'):
+            return detail::put_ascii_("\\\"", buffer);
+        case CharT('\\'):
+            return detail::put_ascii_("\\\\", buffer);
+        case CharT('\b'):
+            return detail::put_ascii_("\\b", buffer);
+        case CharT('\f'):
+            return detail::put_ascii_("\\f", buffer);
+        case CharT('\n'):
+            return detail::put_ascii_("\\n", buffer);
+        case CharT('\r'):
+            return detail::put_ascii_("\\r", buffer);
+        case CharT('\t'):
+            return detail::put_ascii_("\\t", buffer);
+        default: {
+            auto const length = detail::put_ascii_("\\u00", buffer);
+            buffer[length] = static_cast<CharT>("0123456789abcdef"[ch >> 4]);
+            buffer[length + 1uz] = static_cast<CharT>("0123456789abcdef"[ch & 0x0f]);
+
+            return length + 2uz;
+        }
+        }
+    });
+}
+
+/**
+ * @brief appends str to out with '&', '<', '>', '"' and '\'' replaced by character references
+ * @brief str must not refer to out
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr void append_html_escaped(basic_string<CharT, Traits, Allocator> &out,
+                                          ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> str)
+{
+    detail::append_escaped_(out, str, detail::html_special_<CharT>{}, [](CharT ch, CharT *buffer) noexcept {
+        switch (ch)
+        {
+        case CharT('&'):
+            return detail::put_ascii_("&amp;", buffer);
+        case CharT('<'):
+            return detail::put_ascii_("&lt;", buffer);
+        case CharT('>'):
+            return detail::put_ascii_("&gt;", buffer);
+        case CharT('"'):
+            return detail::put_ascii_("&quot;", buffer);
+        default:
+            return detail::put_ascii_("&#39;", buffer);
+        }
+    });
+}
+
+/**
+ * @brief appends field to out as a CSV field, see RFC 4180
+ * @brief the field is quoted only if it contains the delimiter, '"', '\n' or '\r', and '"' is doubled then
+ * @brief field must not refer to out
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr void append_csv_quoted(basic_string<CharT, Traits, Allocator> &out,
+                                        ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> field,
+                                        ::std::type_identity_t<CharT> delimiter = CharT(','))
+{
+    auto const first = field.data();
+    auto const last = first + field.size();
+
+    if (detail::find_special_(first, last, detail::csv_special_<CharT>{delimiter}) == last)
+    {
+        out.append(first, field.size());
+
+        return;
+    }
+
+    detail::grow_for_(out, field.size() + 2uz);
+    out.push_back(CharT('"'));
+    detail::append_escaped_(out, field, detail::char_special_<CharT>{CharT('"')}, [](CharT, CharT *buffer) noexcept {
+        return detail::put_ascii_("\"\"", buffer);
+    });
+    out.push_back(CharT('"'));
+}
+
+/**
+ * @brief replaces the JSON escape sequences in str in place, \uXXXX and surrogate pairs are encoded as UTF-8,
+ * @brief UTF-16 or UTF-32 depending on CharT, the result is never longer, so str is not reallocated
+ * @return false if an escape sequence is malformed, the content of str is unspecified then
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr bool json_unescape(basic_string<CharT, Traits, Allocator> &str)
+{
+    auto const begin = str.data();
+    auto const last = begin + str.size();
+    auto const backslash = detail::char_special_<CharT>{CharT('\\')};
+    CharT const *read = detail::find_special_<CharT>(begin, last, backslash);
+    auto write = begin + (read - begin);
+
+    // 0x10000 if the 4 characters are missing or any of them is not a hex digit
+    auto const hex4 = [&last](CharT const *p) noexcept {
+        auto value = 0u;
+
+        if (last - p < 4)
+            return 0x10000u;
+
+        for (auto i = 0; i != 4; ++i)
+        {
+            auto const digit = detail::hex_digit_(p[i]);
+
+            if (digit > 15u)
+                return 0x10000u;
+
+            value = value << 4 | digit;
+        }
+
+        return value;
+    };
+
+    while (read != last)
+    {
+        if (last - read < 2)
+            return false;
+
+        switch (read[1])
+        {
+        case CharT('"'):
+        case CharT('\\'):
+        case CharT('/'):
+            *write++ = read[1];
+            read += 2;
+            break;
+        case CharT('b'):
+            *write++ = CharT('\b');
+            read += 2;
+            break;
+        case CharT('f'):
+            *write++ = CharT('\f');
+            read += 2;
+            break;
+        case CharT('n'):
+            *write++ = CharT('\n');
+            read += 2;
+            break;
+        case CharT('r'):
+            *write++ = CharT('\r');
+            read += 2;
+            break;
+        case CharT('t'):
+            *write++ = CharT('\t');
+            read += 2;
+            break;
+        case CharT('u'): {
+            auto code_point = static_cast<char32_t>(hex4(read + 2));
+            read += 6;
+
+            if (code_point > 0xffffu || (code_point >= 0xdc00u && code_point <= 0xdfffu))
+                return false;
+
+            if (code_point >= 0xd800u && code_point <= 0xdbffu)
+            {
+                if (last - read < 2 || read[0] != CharT('\\') || read[1] != CharT('u'))
+                    return false;
+
+                auto const low = static_cast<char32_t>(hex4(read + 2));
+
+                if (low < 0xdc00u || low > 0xdfffu)
+                    return false;
+
+                code_point = 0x10000u + ((code_point - 0xd800u) << 10) + (low - 0xdc00u);
+                read += 6;
+            }
+
+            write = detail::encode_utf_(code_point, write);
+            break;
+        }
+        default:
+            return false;
+        }
+
+        auto const next = detail::find_special_(read, last, backslash);
+        write = ::std::ranges::copy(read, next, write).out;
+        read = next;
+    }
+
+    str.resize(static_cast<::std::size_t>(write - begin));
+
+    return true;
+}
+
+/**
+ * @brief replaces &amp; &lt; &gt; &quot; &apos; &#39; and numeric character references in str in place, numeric
+ * @brief references are encoded as UTF-8, UTF-16 or UTF-32 depending on CharT
+ * @brief other or invalid references are left unchanged, the result is never longer, so str is not reallocated
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr void html_unescape(basic_string<CharT, Traits, Allocator> &str)
+{
+    auto const begin = str.data();
+    auto const last = begin + str.size();
+    auto const ampersand = detail::char_special_<CharT>{CharT('&')};
+    CharT const *read = detail::find_special_<CharT>(begin, last, ampersand);
+    auto write = begin + (read - begin);
+
+    // the longest reference is &#x10FFFF; or &#1114111; with leading zeros, which are not worth supporting
+    auto const max_length = 12uz;
+
+    while (read != last)
+    {
+        auto const limit = read + ::std::ranges::min(static_cast<::std::size_t>(last - read), max_length);
+        auto const semicolon = ::std::ranges::find(read + 1, limit, CharT(';'));
+        auto replaced = false;
+
+        if (semicolon != limit)
+        {
+            auto const name = read + 1;
+            char32_t code_point{};
+
+            if (detail::equal_ascii_(name, semicolon, "amp"))
+                code_point = U'&';
+            else if (detail::equal_ascii_(name, semicolon, "lt"))
+                code_point = U'<';
+            else if (detail::equal_ascii_(name, semicolon, "gt"))
+                code_point = U'>';
+            else if (detail::equal_ascii_(name, semicolon, "quot"))
+                code_point = U'"';
+            else if (detail::equal_ascii_(name, semicolon, "apos"))
+                code_point = U'\'';
+            else if (semicolon - name >= 2 && *name == CharT('#'))
+            {
+                auto const hex = name[1] == CharT('x') || name[1] == CharT('X');
+                auto digits = name + 1 + hex;
+                auto const base = hex ? 16u : 10u;
+
+                if (digits == semicolon)
+                    code_point = 0u;
+
+                for (; digits != semicolon; ++digits)
+                {
+                    auto const digit = detail::hex_digit_(*digits);
+
+                    if (digit >= base || code_point > 0x10ffffu)
+                    {
+                        code_point = 0u;
+                        break;
+                    }
+
+                    code_point = code_point * base + digit;
+                }
+
+                if (code_point > 0x10ffffu || (code_point >= 0xd800u && code_point <= 0xdfffu))
+                    code_point = 0u;
+            }
+
+            if (code_point != 0u)
+            {
+                write = detail::encode_utf_(code_point, write);
+                read = semicolon + 1;
+                replaced = true;
+            }
+        }
+
+        if (!replaced)
+            *write++ = *read++;
+
+        auto const next = detail::find_special_(read, last, ampersand);
+        write = ::std::ranges::copy(read, next, write).out;
+        read = next;
+    }
+
+    str.resize(static_cast<::std::size_t>(write - begin));
+}
+
+/**
+ * @brief removes the quotes around a CSV field and replaces "" with " in place, unquoted fields are unchanged
+ * @return false if the field starts with '"' but is not a valid quoted field, str is unchanged then
+ */
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr bool csv_unquote(basic_string<CharT, Traits, Allocator> &str)
+{
+    auto const begin = str.data();
+    auto const size = str.size();
+
+    if (size == 0uz || begin[0] != CharT('"'))
+        return true;
+
+    if (size < 2uz || begin[size - 1uz] != CharT('"'))
+        return false;
+
+    auto const quote = detail::char_special_<CharT>{CharT('"')};
+    auto const last = begin + size - 1uz;
+
+    // quotes inside the field must be doubled
+    for (CharT const *it = detail::find_special_<CharT>(begin + 1, last, quote); it != last;
+         it = detail::find_special_(it + 2, last, quote))
+    {
+        if (it + 1 == last || it[1] != CharT('"'))
+            return false;
+    }
+
+    auto write = begin;
+
+    for (CharT const *read = begin + 1; read != last;)
+    {
+        auto const next = detail::find_special_(read, last, quote);
+        write = ::std::ranges::copy(read, next, write).out;
+
+        if (next == last)
+            break;
+
+        *write++ = CharT('"');
+        read = next + 2;
+    }
+
+    str.resize(static_cast<::std::size_t>(write - begin));
+
+    return true;
+}
+} // namespace bizwen
+
+#endif
@@ -0,0 +1,208 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_FIXED_STRING_HPP)
+#define BIZWEN_FIXED_STRING_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a string of exactly N characters stored inline with a null terminator, which is a structural type, so it can
+ * @brief be a template argument, and a literal type, so it can be built and compared in constant expressions
+ * @brief converting to basic_string copies the characters once, a string of at most short_str_max_ characters does
+ * @brief not allocate
+ */
+template <typename CharT, ::std::size_t N>
+struct basic_fixed_string
+{
+    /**
+     * @brief public because a structural type cannot have private members, use the member functions instead
+     */
+    CharT chars_[N + 1uz]{};
+
+    using value_type = CharT;
+    using size_type = ::std::size_t;
+    using const_iterator = CharT const *;
+    using iterator = const_iterator;
+    using view_type = ::std::basic_string_view<CharT>;
+
+    constexpr basic_fixed_string() noexcept = default;
+
+    /**
+     * @param str, a string literal, whose last character is the null terminator
+     */
+    consteval basic_fixed_string(CharT const (&str)[N + 1uz]) noexcept
+    {
+        ::std::ranges::copy(str, str + N, chars_);
+    }
+
+    /**
+     * @param str, which has N characters
+     * @throw std::length_error if the size of str is not N
+     */
+    constexpr explicit basic_fixed_string(view_type str)
+    {
+        if (str.size() != N)
+            throw ::std::length_error("the size of str is not the size of basic_fixed_string.");
+
+        ::std::ranges::copy(str, chars_);
+    }
+
+    static constexpr size_type size() noexcept
+    {
+        return N;
+    }
+
+    static constexpr size_type length() noexcept
+    {
+        return N;
+    }
+
+    static constexpr bool empty() noexcept
+    {
+        return N == 0uz;
+    }
+
+    constexpr CharT const *data() const noexcept
+    {
+        return chars_;
+    }
+
+    constexpr CharT const *c_str() const noexcept
+    {
+        return chars_;
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+        return chars_;
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+        return chars_ + N;
+    }
+
+    constexpr CharT const &operator[](size_type pos) const noexcept
+    {
+        return chars_[pos];
+    }
+
+    constexpr view_type view() const noexcept
+    {
+        return view_type(chars_, N);
+    }
+
+    constexpr operator view_type() const noexcept
+    {
+        return view();
+    }
+
+    /**
+     * @brief the size is a constant, so the characters are copied without measuring them
+     */
+    template <typename Traits, typename Allocator>
+    constexpr operator basic_string<CharT, Traits, Allocator>() const
+    {
+        return basic_string<CharT, Traits, Allocator>(chars_, N);
+    }
+
+    constexpr basic_string<CharT> to_string() const
+    {
+        return basic_string<CharT>(chars_, N);
+    }
+
+    template <::std::size_t M>
+    friend constexpr bool operator==(basic_fixed_string const &lhs, basic_fixed_string<CharT, M> const &rhs) noexcept
+    {
+        if constexpr (N != M)
+            return false;
+        else
+            return lhs.view() == rhs.view();
+    }
+
+    friend constexpr bool operator==(basic_fixed_string const &lhs, view_type rhs) noexcept
+    {
+        return lhs.view() == rhs;
+    }
+
+    template <::std::size_t M>
+    friend constexpr auto operator<=>(basic_fixed_string const &lhs, basic_fixed_string<CharT, M> const &rhs) noexcept
+    {
+        return lhs.view() <=> rhs.view();
+    }
+
+    friend constexpr auto operator<=>(basic_fixed_string const &lhs, view_type rhs) noexcept
+    {
+        return lhs.view() <=> rhs;
+    }
+
+    /**
+     * @return the concatenation, whose size is the sum of the sizes
+     */
+    template <::std::size_t M>
+    friend constexpr basic_fixed_string<CharT, N + M> operator+(basic_fixed_string const &lhs,
+                                                                basic_fixed_string<CharT, M> const &rhs) noexcept
+    {
+        basic_fixed_string<CharT, N + M> result;
+        ::std::ranges::copy(rhs.view(), ::std::ranges::copy(lhs.view(), result.chars_).out);
+
+        return result;
+    }
+};
+
+template <typename CharT, ::std::size_t N>
+basic_fixed_string(CharT const (&)[N]) -> basic_fixed_string<CharT, N - 1uz>;
+
+template <::std::size_t N>
+using fixed_string = basic_fixed_string<char, N>;
+template <::std::size_t N>
+using wfixed_string = basic_fixed_string<wchar_t, N>;
+template <::std::size_t N>
+using u8fixed_string = basic_fixed_string<char8_t, N>;
+template <::std::size_t N>
+using u16fixed_string = basic_fixed_string<char16_t, N>;
+template <::std::size_t N>
+using u32fixed_string = basic_fixed_string<char32_t, N>;
+
+inline namespace literals
+{
+inline namespace fixed_string_literals
+{
+/**
+ * @brief "abc"_fs is a basic_fixed_string<char, 3>, which is built at compile time
+ */
+template <basic_fixed_string str>
+consteval auto operator""_fs() noexcept
+{
+    return str;
+}
+} // namespace fixed_string_literals
+} // namespace literals
+} // namespace bizwen
+
+namespace std
+{
+template <typename CharT, ::std::size_t N>
+struct hash<bizwen::basic_fixed_string<CharT, N>>
+{
+    static constexpr ::std::size_t operator()(bizwen::basic_fixed_string<CharT, N> const &str) noexcept
+    {
+        ::std::hash<::std::basic_string_view<CharT>> hasher;
+
+        return hasher(str.view());
+    }
+};
+} // namespace std
+
+#endif
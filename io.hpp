@@ -0,0 +1,276 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_IO_HPP)
+#define BIZWEN_IO_HPP
+
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__cpp_lib_generator) && (__cpp_lib_generator >= 202207L)
+#include <generator>
+#endif
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief reads a file descriptor in large blocks and splits the content into lines
+ * @brief every line is a view into one reusable buffer, which is invalidated by the next call of next()
+ * @brief a line spanning two blocks is moved to the front of the buffer, the buffer only grows when
+ * @brief a single line is longer than it
+ */
+class line_reader
+{
+    int fd_{-1};
+    bool owns_{};
+    bool eof_{};
+
+    /**
+     * @brief begin of the unconsumed characters in buffer_
+     */
+    ::std::size_t pos_{};
+
+    /**
+     * @brief characters in [pos_, scanned_) are known to contain no line feed
+     */
+    ::std::size_t scanned_{};
+
+    string buffer_;
+
+    /**
+     * @brief compacts the unconsumed tail to the front and reads into the spare capacity
+     */
+    void fill_()
+    {
+        if (pos_ != 0uz)
+        {
+            buffer_.erase(0uz, pos_);
+            scanned_ -= pos_;
+            pos_ = 0uz;
+        }
+
+        // the line does not fit, use size * 1.5 for growth
+        if (auto const size = buffer_.size(); size == buffer_.capacity())
+            buffer_.reserve(size * 2uz - size / 2uz);
+
+        auto const size = buffer_.size();
+        ::ssize_t count{};
+        int error{};
+
+        buffer_.resize_and_overwrite(buffer_.capacity(), [&](char *data, ::std::size_t cap) noexcept {
+            do
+                count = ::read(fd_, data + size, cap - size);
+            while (count == -1 && errno == EINTR);
+
+            error = errno;
+
+            return count > 0 ? size + static_cast<::std::size_t>(count) : size;
+        });
+
+        if (count < 0)
+            throw ::std::system_error(error, ::std::generic_category(), "read");
+
+        eof_ = count == 0;
+    }
+
+  public:
+    static inline constexpr ::std::size_t default_block_size{1uz << 20};
+
+    /**
+     * @param fd, an open file descriptor, which is not closed by line_reader
+     */
+    explicit line_reader(int fd, ::std::size_t block_size = default_block_size) : fd_(fd)
+    {
+        buffer_.reserve(block_size);
+    }
+
+    /**
+     * @param path, the file is opened read only and closed by the destructor
+     */
+    explicit line_reader(char const *path, ::std::size_t block_size = default_block_size) : owns_(true)
+    {
+        do
+            fd_ = ::open(path, O_RDONLY | O_CLOEXEC);
+        while (fd_ == -1 && errno == EINTR);
+
+        if (fd_ == -1)
+            throw ::std::system_error(errno, ::std::generic_category(), path);
+
+        buffer_.reserve(block_size);
+    }
+
+    line_reader(line_reader const &) = delete;
+    line_reader &operator=(line_reader const &) = delete;
+
+    ~line_reader()
+    {
+        if (owns_)
+            ::close(fd_);
+    }
+
+    /**
+     * @brief the line feed is not part of the line, the last line may not end with a line feed
+     * @return false if there are no more lines
+     */
+    bool next(::std::string_view &line)
+    {
+        for (;;)
+        {
+            auto const data = buffer_.data();
+            auto const size = buffer_.size();
+
+            if (auto const lf =
+                    static_cast<char const *>(::std::memchr(data + scanned_, '\n', size - scanned_)))
+            {
+                line = {data + pos_, lf};
+                pos_ = scanned_ = static_cast<::std::size_t>(lf - data) + 1uz;
+
+                return true;
+            }
+
+            scanned_ = size;
+
+            if (eof_)
+            {
+                if (pos_ == size)
+                    return false;
+
+                line = {data + pos_, data + size};
+                pos_ = size;
+
+                return true;
+            }
+
+            fill_();
+        }
+    }
+};
+
+#if defined(__cpp_lib_generator) && (__cpp_lib_generator >= 202207L)
+/**
+ * @brief yields the lines of fd, see line_reader
+ */
+inline ::std::generator<::std::string_view> lines(int fd, ::std::size_t block_size = line_reader::default_block_size)
+{
+    line_reader reader{fd, block_size};
+
+    for (::std::string_view line; reader.next(line);)
+        co_yield line;
+}
+
+/**
+ * @brief yields the lines of the file at path, see line_reader
+ * @param path, taken by value because the generator starts lazily
+ */
+inline ::std::generator<::std::string_view> lines(string path,
+                                                  ::std::size_t block_size = line_reader::default_block_size)
+{
+    line_reader reader{path.c_str(), block_size};
+
+    for (::std::string_view line; reader.next(line);)
+        co_yield line;
+}
+#endif
+
+namespace detail
+{
+#if defined(IOV_MAX)
+inline constexpr ::std::size_t iov_max_{IOV_MAX};
+#else
+inline constexpr ::std::size_t iov_max_{_XOPEN_IOV_MAX};
+#endif
+
+/**
+ * @brief writes count buffers completely, continues after partial writes
+ * @return number of bytes written
+ */
+inline ::std::size_t writev_(int fd, ::iovec *iov, ::std::size_t count)
+{
+    ::std::size_t total{};
+
+    while (count != 0uz)
+    {
+        auto const result = ::writev(fd, iov, static_cast<int>(count));
+
+        if (result == -1)
+        {
+            if (errno == EINTR)
+                continue;
+
+            throw ::std::system_error(errno, ::std::generic_category(), "writev");
+        }
+
+        auto written = static_cast<::std::size_t>(result);
+        total += written;
+
+        // drop the buffers that are written, and advance the first one that is partially written
+        for (; count != 0uz && written >= iov->iov_len; ++iov, --count)
+            written -= iov->iov_len;
+
+        if (count != 0uz)
+        {
+            iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+            iov->iov_len -= written;
+        }
+    }
+
+    return total;
+}
+} // namespace detail
+
+/**
+ * @brief writes every element of rg to fd with writev, without concatenating them
+ * @brief iovec is built from data() and size() directly, empty elements are skipped
+ * @brief elements are gathered in batches of at most IOV_MAX, partial writes are continued
+ * @param rg, a range of bizwen::basic_string, ::std::string_view or anything convertible to ::std::string_view,
+ * @param rg, elements returned by value must not own their characters
+ * @return number of bytes written
+ */
+template <::std::ranges::input_range R>
+    requires ::std::convertible_to<::std::ranges::range_reference_t<R>, ::std::string_view> &&
+             (::std::is_lvalue_reference_v<::std::ranges::range_reference_t<R>> ||
+              ::std::ranges::borrowed_range<::std::ranges::range_reference_t<R>>)
+inline ::std::size_t writev_all(int fd, R &&rg)
+{
+    ::std::array<::iovec, detail::iov_max_> iov;
+    ::std::size_t total{};
+    auto first = ::std::ranges::begin(rg);
+    auto const last = ::std::ranges::end(rg);
+
+    for (;;)
+    {
+        auto count = 0uz;
+
+        for (; count != iov.size() && first != last; ++first)
+        {
+            ::std::string_view const sv = *first;
+
+            if (!sv.empty())
+                iov[count++] = {const_cast<char *>(sv.data()), sv.size()};
+        }
+
+        if (count == 0uz)
+            return total;
+
+        total += detail::writev_(fd, iov.data(), count);
+    }
+}
+} // namespace bizwen
+
+#endif
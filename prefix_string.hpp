@@ -0,0 +1,207 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_PREFIX_STRING_HPP)
+#define BIZWEN_PREFIX_STRING_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a 16-byte string reference which keeps the length and the first characters inline, see Neumann and Freitag,
+ * @brief Umbra: A Disk-Based System with In-Memory Performance
+ * @brief strings of at most 12 bytes are copied inline, longer strings are referenced and only their first 4 bytes
+ * @brief are copied, so comparisons of strings with different lengths or prefixes do not read the referenced
+ * @brief characters, which must outlive the view
+ * @brief converting to basic_string_view is cheap, but the result refers to *this for inline strings
+ * @brief the pointer is stored in the bytes after the prefix, so the type cannot be used in constant expressions
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>>
+class basic_prefix_string_view
+{
+    using view_type_ = ::std::basic_string_view<CharT, Traits>;
+
+    static inline constexpr ::std::size_t prefix_size_{4uz / sizeof(CharT)};
+
+  public:
+    /**
+     * @brief strings of at most this size are stored inline
+     */
+    static inline constexpr ::std::size_t inline_capacity{12uz / sizeof(CharT)};
+
+  private:
+    ::std::uint32_t size_{};
+
+    /**
+     * @brief the characters padded with zeros if size_ <= inline_capacity, otherwise the first prefix_size_
+     * @brief characters followed by the bytes of the pointer to the characters, which is unaligned on 32-bit platforms
+     */
+    CharT chars_[inline_capacity]{};
+
+    bool is_inline_() const noexcept
+    {
+        return size_ <= inline_capacity;
+    }
+
+    CharT const *pointer_() const noexcept
+    {
+        CharT const *data;
+        ::std::memcpy(&data, chars_ + prefix_size_, sizeof(data));
+
+        return data;
+    }
+
+  public:
+    using traits_type = Traits;
+    using value_type = CharT;
+    using size_type = ::std::size_t;
+
+    basic_prefix_string_view() noexcept = default;
+
+    /**
+     * @throw std::length_error if str is longer than 2^32 - 1
+     */
+    basic_prefix_string_view(view_type_ str) : size_(static_cast<::std::uint32_t>(str.size()))
+    {
+        if (str.size() > ::std::numeric_limits<::std::uint32_t>::max())
+            throw ::std::length_error("str is too long for basic_prefix_string_view.");
+
+        if (str.size() <= inline_capacity)
+        {
+            Traits::copy(chars_, str.data(), str.size());
+        }
+        else
+        {
+            auto const data = str.data();
+            Traits::copy(chars_, data, prefix_size_);
+            ::std::memcpy(chars_ + prefix_size_, &data, sizeof(data));
+        }
+    }
+
+    template <typename Allocator>
+    basic_prefix_string_view(basic_string<CharT, Traits, Allocator> const &str)
+        : basic_prefix_string_view(view_type_(str))
+    {
+    }
+
+    // a long string would refer to a destroyed string
+    template <typename Allocator>
+    basic_prefix_string_view(basic_string<CharT, Traits, Allocator> const &&) = delete;
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    size_type length() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return size_ == 0u;
+    }
+
+    /**
+     * @brief points into *this for inline strings
+     */
+    CharT const *data() const noexcept
+    {
+        return is_inline_() ? chars_ : pointer_();
+    }
+
+    view_type_ view() const noexcept
+    {
+        return view_type_(data(), size_);
+    }
+
+    operator view_type_() const noexcept
+    {
+        return view();
+    }
+
+    /**
+     * @brief the lengths are compared first, then the inline characters, the referenced characters are compared
+     * @brief only if the prefixes are equal and the pointers differ
+     */
+    friend bool operator==(basic_prefix_string_view const &lhs, basic_prefix_string_view const &rhs) noexcept
+    {
+        if (lhs.size_ != rhs.size_)
+            return false;
+
+        if (lhs.is_inline_())
+            return ::std::memcmp(lhs.chars_, rhs.chars_, sizeof(chars_)) == 0;
+
+        if (::std::memcmp(lhs.chars_, rhs.chars_, prefix_size_ * sizeof(CharT)) != 0)
+            return false;
+
+        auto const lhs_data = lhs.pointer_();
+        auto const rhs_data = rhs.pointer_();
+
+        return lhs_data == rhs_data ||
+               Traits::compare(lhs_data + prefix_size_, rhs_data + prefix_size_, lhs.size_ - prefix_size_) == 0;
+    }
+
+    /**
+     * @brief the prefixes are compared first, the other characters are compared only if they are equal
+     */
+    friend auto operator<=>(basic_prefix_string_view const &lhs, basic_prefix_string_view const &rhs) noexcept
+    {
+        using result = decltype(lhs.view() <=> rhs.view());
+
+        auto const prefix_size = ::std::ranges::min(
+            {static_cast<::std::size_t>(lhs.size_), static_cast<::std::size_t>(rhs.size_), prefix_size_});
+
+        if (auto const r = Traits::compare(lhs.chars_, rhs.chars_, prefix_size); r != 0)
+            return static_cast<result>(r <=> 0);
+
+        if (lhs.size_ <= prefix_size_ || rhs.size_ <= prefix_size_)
+            return static_cast<result>(lhs.size_ <=> rhs.size_);
+
+        return lhs.view() <=> rhs.view();
+    }
+};
+
+template <typename CharT, typename Traits, typename Allocator>
+basic_prefix_string_view(basic_string<CharT, Traits, Allocator> const &) -> basic_prefix_string_view<CharT, Traits>;
+
+template <typename CharT, typename Traits>
+basic_prefix_string_view(::std::basic_string_view<CharT, Traits>) -> basic_prefix_string_view<CharT, Traits>;
+
+static_assert(sizeof(basic_prefix_string_view<char>) == 16uz);
+
+using prefix_string_view = basic_prefix_string_view<char>;
+using wprefix_string_view = basic_prefix_string_view<wchar_t>;
+using u8prefix_string_view = basic_prefix_string_view<char8_t>;
+using u16prefix_string_view = basic_prefix_string_view<char16_t>;
+using u32prefix_string_view = basic_prefix_string_view<char32_t>;
+} // namespace bizwen
+
+namespace std
+{
+template <typename CharT, typename Traits>
+struct hash<bizwen::basic_prefix_string_view<CharT, Traits>>
+{
+    static constexpr ::std::size_t operator()(bizwen::basic_prefix_string_view<CharT, Traits> const &str) noexcept
+    {
+        ::std::hash<::std::basic_string_view<CharT>> hasher;
+
+        return hasher(::std::basic_string_view<CharT>(str.data(), str.size()));
+    }
+};
+} // namespace std
+
+#endif
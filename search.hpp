@@ -0,0 +1,547 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_SEARCH_HPP)
+#define BIZWEN_SEARCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief pattern is the index of the pattern in the order given to the searcher, offset is where the match begins
+ */
+struct multi_match
+{
+    ::std::size_t pattern;
+    ::std::size_t offset;
+};
+
+namespace detail
+{
+/**
+ * @brief a callback returning bool stops the search by returning false, other callbacks see every match
+ */
+template <typename Callback, typename Arg>
+inline bool invoke_match_(Callback &callback, Arg arg)
+{
+    if constexpr (::std::is_same_v<::std::invoke_result_t<Callback &, Arg>, bool>)
+        return callback(arg);
+    else
+        return callback(arg), true;
+}
+} // namespace detail
+
+/**
+ * @brief finds every occurrence of a set of patterns in one pass over the text with an Aho-Corasick automaton
+ * @brief the automaton is a DFA whose columns are byte classes, bytes that do not occur in any pattern share one
+ * @brief class, so the table stays small for thousands of patterns
+ * @brief while the automaton is in the start state, the text is skipped to the next first byte of a pattern with
+ * @brief the SIMD kernel, which is enabled for at most 16 distinct first bytes
+ * @brief empty patterns never match
+ */
+template <typename CharT>
+    requires(sizeof(CharT) == 1uz)
+class basic_multi_searcher
+{
+    static inline constexpr ::std::uint32_t none_{static_cast<::std::uint32_t>(-1)};
+    static inline constexpr ::std::size_t max_heads_{16uz};
+
+    ::std::array<::std::uint16_t, 256uz> classes_{};
+    ::std::size_t stride_{1uz};
+
+    /**
+     * @brief delta_[state * stride_ + class] is the next state, state 0 is the start state
+     */
+    ::std::vector<::std::uint32_t> delta_;
+
+    /**
+     * @brief report_[state] is the nearest state on the suffix chain of state, including itself, where a pattern
+     * @brief ends, or 0
+     */
+    ::std::vector<::std::uint32_t> report_;
+
+    /**
+     * @brief dict_[state] is the nearest state on the suffix chain of state, excluding itself, where a pattern ends,
+     * @brief or 0
+     */
+    ::std::vector<::std::uint32_t> dict_;
+
+    /**
+     * @brief terminal_[state] is the first pattern ending at state, equal patterns are chained by next_pattern_
+     */
+    ::std::vector<::std::uint32_t> terminal_;
+    ::std::vector<::std::uint32_t> next_pattern_;
+    ::std::vector<::std::size_t> lengths_;
+
+    ::std::array<CharT, max_heads_> heads_{};
+    ::std::size_t heads_size_{};
+
+    void build_(::std::vector<::std::basic_string_view<CharT>> const &patterns)
+    {
+        auto const count = patterns.size();
+        lengths_.resize(count);
+        next_pattern_.assign(count, none_);
+
+        ::std::array<bool, 256uz> used{};
+        ::std::array<bool, 256uz> head{};
+
+        for (auto i = 0uz; i != count; ++i)
+        {
+            lengths_[i] = patterns[i].size();
+
+            if (patterns[i].empty())
+                continue;
+
+            head[static_cast<unsigned char>(patterns[i].front())] = true;
+
+            for (auto const ch : patterns[i])
+                used[static_cast<unsigned char>(ch)] = true;
+        }
+
+        for (auto i = 0uz; i != used.size(); ++i)
+        {
+            if (used[i])
+                classes_[i] = static_cast<::std::uint16_t>(stride_++);
+
+            if (head[i])
+            {
+                if (heads_size_ < max_heads_)
+                    heads_[heads_size_] = static_cast<CharT>(i);
+
+                ++heads_size_;
+            }
+        }
+
+        // too many first bytes, the prefilter would not skip enough to pay off
+        if (heads_size_ > max_heads_)
+            heads_size_ = 0uz;
+
+        // build the trie, a missing edge is 0 since no edge of the trie leads to the start state
+        delta_.assign(stride_, 0u);
+        terminal_.assign(1uz, none_);
+
+        for (auto i = 0uz; i != count; ++i)
+        {
+            if (patterns[i].empty())
+                continue;
+
+            auto state = 0uz;
+
+            for (auto const ch : patterns[i])
+            {
+                auto const index = state * stride_ + classes_[static_cast<unsigned char>(ch)];
+
+                if (delta_[index] == 0u)
+                {
+                    auto const next = terminal_.size();
+                    delta_[index] = static_cast<::std::uint32_t>(next);
+                    delta_.resize(delta_.size() + stride_);
+                    terminal_.push_back(none_);
+                }
+
+                state = delta_[index];
+            }
+
+            // keep equal patterns in the order they are given
+            auto *link = &terminal_[state];
+
+            while (*link != none_)
+                link = &next_pattern_[*link];
+
+            *link = static_cast<::std::uint32_t>(i);
+        }
+
+        // turn the trie into a DFA in breadth first order, so the row of the suffix of a state is complete before
+        // the state is visited
+        auto const states = terminal_.size();
+        ::std::vector<::std::uint32_t> fail(states);
+        ::std::vector<::std::uint32_t> queue;
+        queue.reserve(states);
+        report_.assign(states, 0u);
+        dict_.assign(states, 0u);
+        queue.push_back(0u);
+
+        for (auto front = 0uz; front != queue.size(); ++front)
+        {
+            auto const state = queue[front];
+
+            for (auto cls = 1uz; cls != stride_; ++cls)
+            {
+                auto const next = delta_[state * stride_ + cls];
+
+                if (next == 0u)
+                {
+                    delta_[state * stride_ + cls] = delta_[fail[state] * stride_ + cls];
+
+                    continue;
+                }
+
+                auto const suffix = state == 0u ? 0u : delta_[fail[state] * stride_ + cls];
+                fail[next] = suffix;
+                dict_[next] = terminal_[suffix] != none_ ? suffix : dict_[suffix];
+                report_[next] = terminal_[next] != none_ ? next : dict_[next];
+                queue.push_back(next);
+            }
+        }
+    }
+
+  public:
+    using value_type = CharT;
+    using string_view_type = ::std::basic_string_view<CharT>;
+
+    basic_multi_searcher() = default;
+
+    /**
+     * @param patterns, a range of anything convertible to string_view_type, the patterns are not referenced after
+     * @param patterns, the construction
+     */
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, string_view_type>
+    explicit basic_multi_searcher(R &&patterns)
+    {
+        ::std::vector<string_view_type> views;
+
+        for (string_view_type const pattern : patterns)
+            views.push_back(pattern);
+
+        build_(views);
+    }
+
+    basic_multi_searcher(::std::initializer_list<string_view_type> patterns)
+    {
+        build_(::std::vector<string_view_type>(patterns));
+    }
+
+    ::std::size_t pattern_count() const noexcept
+    {
+        return lengths_.size();
+    }
+
+    ::std::size_t state_count() const noexcept
+    {
+        return terminal_.size();
+    }
+
+    /**
+     * @brief calls callback with a multi_match for every occurrence of every pattern, matches are reported in the
+     * @brief order of their end, overlapping matches are all reported
+     * @param callback, if it returns bool, returning false stops the search
+     */
+    template <typename Callback>
+    void for_each_match(string_view_type text, Callback &&callback) const
+    {
+        if (delta_.empty())
+            return;
+
+        auto const first = text.data();
+        auto const last = first + text.size();
+        auto const delta = delta_.data();
+        auto const stride = stride_;
+        ::std::size_t state{};
+
+        for (auto it = first; it != last;)
+        {
+            if (state == 0uz && heads_size_ != 0uz)
+            {
+                it = detail::find_first_of_(it, last, heads_.data(), heads_size_);
+
+                if (it == last)
+                    return;
+            }
+
+            state = delta[state * stride + classes_[static_cast<unsigned char>(*it)]];
+            ++it;
+
+            for (auto output = report_[state]; output != 0u; output = dict_[output])
+            {
+                for (auto pattern = terminal_[output]; pattern != none_; pattern = next_pattern_[pattern])
+                {
+                    auto const end = static_cast<::std::size_t>(it - first);
+
+                    if (!detail::invoke_match_(callback, multi_match{pattern, end - lengths_[pattern]}))
+                        return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @return every match, see for_each_match
+     */
+    ::std::vector<multi_match> find_all(string_view_type text) const
+    {
+        ::std::vector<multi_match> matches;
+        for_each_match(text, [&matches](multi_match match) { matches.push_back(match); });
+
+        return matches;
+    }
+};
+
+using multi_searcher = basic_multi_searcher<char>;
+using u8multi_searcher = basic_multi_searcher<char8_t>;
+
+/**
+ * @brief a needle whose search tables are computed once and reused for many haystacks
+ * @brief needles shorter than two_way_threshold are found with the SIMD kernel that filters positions by the first
+ * @brief and the last character, longer needles with the Two-Way algorithm, which is linear in the worst case and
+ * @brief skips with a shift table indexed by the low byte of the last character of the window
+ */
+template <typename CharT>
+class basic_precompiled_needle
+{
+    basic_string<CharT> needle_;
+    bool use_two_way_{};
+
+    /**
+     * @brief the critical factorization is needle_[0, critical_ + 1) and needle_[critical_ + 1, size)
+     */
+    ::std::size_t critical_{};
+    ::std::size_t period_{};
+
+    /**
+     * @brief the prefix known to match after shifting by a period, only non-zero for periodic needles
+     */
+    ::std::size_t memory_{};
+
+    ::std::array<bool, 256uz> byteset_{};
+
+    /**
+     * @brief shift_[b] is one more than the last index of a character with low byte b
+     */
+    ::std::array<::std::size_t, 256uz> shift_{};
+
+    using uchar_ = ::std::make_unsigned_t<CharT>;
+
+    /**
+     * @return the start of the maximal suffix, minus one, for the order less, or the reversed order, and its period
+     */
+    ::std::pair<::std::size_t, ::std::size_t> maximal_suffix_(bool reversed) const noexcept
+    {
+        auto const n = needle_.data();
+        auto const l = needle_.size();
+        auto ip = static_cast<::std::size_t>(-1);
+        auto jp = 0uz;
+        auto k = 1uz;
+        auto p = 1uz;
+
+        while (jp + k < l)
+        {
+            auto const a = static_cast<uchar_>(n[ip + k]);
+            auto const b = static_cast<uchar_>(n[jp + k]);
+
+            if (a == b)
+            {
+                if (k == p)
+                {
+                    jp += p;
+                    k = 1uz;
+                }
+                else
+                    ++k;
+            }
+            else if (reversed ? a < b : a > b)
+            {
+                jp += k;
+                k = 1uz;
+                p = jp - ip;
+            }
+            else
+            {
+                ip = jp++;
+                k = p = 1uz;
+            }
+        }
+
+        return {ip, p};
+    }
+
+    CharT const *two_way_(CharT const *h, CharT const *last) const noexcept
+    {
+        auto const n = needle_.data();
+        auto const l = needle_.size();
+        auto const ms = critical_;
+        auto mem = 0uz;
+
+        for (;;)
+        {
+            if (static_cast<::std::size_t>(last - h) < l)
+                return last;
+
+            // check the last character first, and advance by the shift on mismatch
+            if (auto const byte = static_cast<unsigned char>(h[l - 1uz]); byteset_[byte])
+            {
+                if (auto k = l - shift_[byte])
+                {
+                    if (k < mem)
+                        k = mem;
+
+                    h += k;
+                    mem = 0uz;
+
+                    continue;
+                }
+            }
+            else
+            {
+                h += l;
+                mem = 0uz;
+
+                continue;
+            }
+
+            // compare the right half
+            auto k = ::std::ranges::max(ms + 1uz, mem);
+
+            for (; k != l && n[k] == h[k]; ++k)
+                ;
+
+            if (k != l)
+            {
+                h += k - ms;
+                mem = 0uz;
+
+                continue;
+            }
+
+            // compare the left half
+            for (k = ms + 1uz; k > mem && n[k - 1uz] == h[k - 1uz]; --k)
+                ;
+
+            if (k <= mem)
+                return h;
+
+            h += period_;
+            mem = memory_;
+        }
+    }
+
+    CharT const *find_(CharT const *first, CharT const *last) const noexcept
+    {
+        if (use_two_way_)
+            return two_way_(first, last);
+
+        return detail::search_(first, last, needle_.data(), needle_.size());
+    }
+
+  public:
+    using value_type = CharT;
+    using size_type = ::std::size_t;
+    using string_view_type = ::std::basic_string_view<CharT>;
+
+    static inline constexpr size_type npos{static_cast<size_type>(-1)};
+    static inline constexpr size_type two_way_threshold{32uz};
+
+    /**
+     * @param needle, copied into the searcher
+     */
+    explicit basic_precompiled_needle(string_view_type needle) : needle_(needle)
+    {
+        auto const l = needle_.size();
+
+        if (l < two_way_threshold)
+            return;
+
+        use_two_way_ = true;
+
+        for (auto i = 0uz; i != l; ++i)
+        {
+            auto const byte = static_cast<unsigned char>(needle_[i]);
+            byteset_[byte] = true;
+            shift_[byte] = i + 1uz;
+        }
+
+        // the critical factorization is the later of the maximal suffixes for both orders
+        auto const [ms0, p0] = maximal_suffix_(false);
+        auto const [ms1, p1] = maximal_suffix_(true);
+        auto ms = ms0;
+        auto p = p0;
+
+        if (ms1 + 1uz > ms0 + 1uz)
+        {
+            ms = ms1;
+            p = p1;
+        }
+
+        critical_ = ms;
+
+        // the needle is periodic if the left half is repeated one period later
+        if (!::std::ranges::equal(needle_.data(), needle_.data() + ms + 1uz, needle_.data() + p,
+                                  needle_.data() + p + ms + 1uz))
+        {
+            memory_ = 0uz;
+            period_ = ::std::ranges::max(ms, l - ms - 1uz) + 1uz;
+        }
+        else
+        {
+            memory_ = l - p;
+            period_ = p;
+        }
+    }
+
+    string_view_type needle() const noexcept
+    {
+        return needle_;
+    }
+
+    /**
+     * @return position of the first occurrence at or after pos, or npos, an empty needle is found at pos
+     */
+    size_type find(string_view_type haystack, size_type pos = 0uz) const noexcept
+    {
+        if (pos > haystack.size())
+            return npos;
+
+        if (needle_.empty())
+            return pos;
+
+        auto const first = haystack.data();
+        auto const last = first + haystack.size();
+
+        if (auto const it = find_(first + pos, last); it != last)
+            return static_cast<size_type>(it - first);
+
+        return npos;
+    }
+
+    /**
+     * @return positions of the non-overlapping occurrences from left to right, an empty needle is never found
+     */
+    ::std::vector<size_type> find_all(string_view_type haystack) const
+    {
+        ::std::vector<size_type> positions;
+
+        if (needle_.empty())
+            return positions;
+
+        auto const first = haystack.data();
+        auto const last = first + haystack.size();
+
+        for (auto it = find_(first, last); it != last; it = find_(it + needle_.size(), last))
+            positions.push_back(static_cast<size_type>(it - first));
+
+        return positions;
+    }
+};
+
+using precompiled_needle = basic_precompiled_needle<char>;
+using wprecompiled_needle = basic_precompiled_needle<wchar_t>;
+using u8precompiled_needle = basic_precompiled_needle<char8_t>;
+using u16precompiled_needle = basic_precompiled_needle<char16_t>;
+using u32precompiled_needle = basic_precompiled_needle<char32_t>;
+} // namespace bizwen
+
+#endif
@@ -0,0 +1,370 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_SPLIT_HPP)
+#define BIZWEN_SPLIT_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a set of delimiter characters, split() ends a field at any of them
+ * @brief the characters are not copied and must outlive the split range
+ */
+template <typename CharT>
+class any_of
+{
+    ::std::basic_string_view<CharT> chars_;
+
+  public:
+    constexpr explicit any_of(::std::basic_string_view<CharT> chars) noexcept : chars_(chars)
+    {
+    }
+
+    constexpr ::std::basic_string_view<CharT> chars() const noexcept
+    {
+        return chars_;
+    }
+};
+
+template <typename CharT>
+any_of(CharT const *) -> any_of<CharT>;
+
+template <typename CharT, typename Traits>
+any_of(::std::basic_string_view<CharT, Traits>) -> any_of<CharT>;
+
+template <typename CharT, typename Traits, typename Allocator>
+any_of(basic_string<CharT, Traits, Allocator> const &) -> any_of<CharT>;
+
+/**
+ * @brief skip_empty, empty fields are not produced and do not count towards max_splits
+ * @brief max_splits, after that many delimiters the rest of the input is produced as the last field
+ */
+struct split_options
+{
+    bool skip_empty{};
+    ::std::size_t max_splits{static_cast<::std::size_t>(-1)};
+};
+
+namespace detail
+{
+template <typename CharT>
+struct char_delimiter_
+{
+    CharT ch;
+
+    constexpr CharT const *find(CharT const *first, CharT const *last) const noexcept
+    {
+        if !consteval
+        {
+            return find_char_(first, last, ch);
+        }
+
+        return ::std::ranges::find(first, last, ch);
+    }
+
+    constexpr ::std::size_t size() const noexcept
+    {
+        return 1uz;
+    }
+};
+
+/**
+ * @brief an empty delimiter never matches, so the input is a single field
+ */
+template <typename CharT>
+struct string_delimiter_
+{
+    CharT const *data;
+    ::std::size_t length;
+
+    constexpr CharT const *find(CharT const *first, CharT const *last) const noexcept
+    {
+        if (length == 0uz)
+            return last;
+
+        if !consteval
+        {
+            return search_(first, last, data, length);
+        }
+
+        return ::std::ranges::search(first, last, data, data + length).begin();
+    }
+
+    constexpr ::std::size_t size() const noexcept
+    {
+        return length;
+    }
+};
+
+template <typename CharT>
+struct any_of_delimiter_
+{
+    CharT const *data;
+    ::std::size_t length;
+
+    constexpr CharT const *find(CharT const *first, CharT const *last) const noexcept
+    {
+        if !consteval
+        {
+            return find_first_of_(first, last, data, length);
+        }
+
+        return ::std::ranges::find_first_of(first, last, data, data + length);
+    }
+
+    constexpr ::std::size_t size() const noexcept
+    {
+        return 1uz;
+    }
+};
+} // namespace detail
+
+/**
+ * @brief a lazy forward range of the fields of a string, fields are views into the input and nothing is allocated
+ * @brief n delimiters separate n + 1 fields, so an empty input has one empty field unless skip_empty is set
+ * @brief the input and the delimiter are not copied and must outlive the range
+ */
+template <typename CharT, typename Traits, typename Delimiter>
+class basic_split_view : public ::std::ranges::view_interface<basic_split_view<CharT, Traits, Delimiter>>
+{
+    using view_type_ = ::std::basic_string_view<CharT, Traits>;
+
+    CharT const *first_{};
+    CharT const *last_{};
+    Delimiter delimiter_{};
+    split_options options_{};
+
+  public:
+    class iterator
+    {
+        basic_split_view const *parent_{};
+
+        /**
+         * @brief begin of the input after the current field, nullptr if the current field is the last
+         */
+        CharT const *next_{};
+        view_type_ field_{};
+        ::std::size_t splits_{};
+        bool end_{true};
+
+        constexpr void advance_() noexcept
+        {
+            do
+            {
+                if (next_ == nullptr)
+                {
+                    end_ = true;
+
+                    return;
+                }
+
+                auto const last = parent_->last_;
+                auto const pos = splits_ != 0uz ? parent_->delimiter_.find(next_, last) : last;
+
+                if (pos == last)
+                {
+                    field_ = view_type_(next_, last);
+                    next_ = nullptr;
+                }
+                else
+                {
+                    field_ = view_type_(next_, pos);
+                    next_ = pos + parent_->delimiter_.size();
+
+                    // a skipped field does not count towards max_splits
+                    if (!parent_->options_.skip_empty || !field_.empty())
+                        --splits_;
+                }
+            } while (parent_->options_.skip_empty && field_.empty());
+        }
+
+        friend basic_split_view;
+
+        constexpr iterator(basic_split_view const *parent) noexcept
+            : parent_(parent), next_(parent->first_), splits_(parent->options_.max_splits), end_(false)
+        {
+            advance_();
+        }
+
+      public:
+        using value_type = view_type_;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::forward_iterator_tag;
+        using iterator_category = ::std::input_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr view_type_ operator*() const noexcept
+        {
+            return field_;
+        }
+
+        constexpr iterator &operator++() noexcept
+        {
+            advance_();
+
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            advance_();
+
+            return temp;
+        }
+
+        /**
+         * @brief fields begin at strictly increasing positions, so the begin of the field identifies the iterator
+         */
+        friend constexpr bool operator==(iterator const &lhs, iterator const &rhs) noexcept
+        {
+            return lhs.end_ == rhs.end_ && (lhs.end_ || lhs.field_.data() == rhs.field_.data());
+        }
+    };
+
+    constexpr basic_split_view() noexcept = default;
+
+    constexpr basic_split_view(view_type_ str, Delimiter delimiter, split_options options) noexcept
+        : first_(str.data()), last_(str.data() + str.size()), delimiter_(delimiter), options_(options)
+    {
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return iterator{this};
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return iterator{};
+    }
+};
+
+/**
+ * @brief splits str at every ch, see basic_split_view
+ */
+template <typename CharT, typename Traits>
+inline constexpr basic_split_view<CharT, Traits, detail::char_delimiter_<CharT>> split(
+    ::std::basic_string_view<CharT, Traits> str, ::std::type_identity_t<CharT> ch, split_options options = {}) noexcept
+{
+    return {str, {ch}, options};
+}
+
+/**
+ * @brief splits str at every occurrence of delimiter, see basic_split_view
+ */
+template <typename CharT, typename Traits>
+inline constexpr basic_split_view<CharT, Traits, detail::string_delimiter_<CharT>> split(
+    ::std::basic_string_view<CharT, Traits> str, ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> delimiter,
+    split_options options = {}) noexcept
+{
+    return {str, {delimiter.data(), delimiter.size()}, options};
+}
+
+/**
+ * @brief splits str at every character of set, see basic_split_view
+ */
+template <typename CharT, typename Traits>
+inline constexpr basic_split_view<CharT, Traits, detail::any_of_delimiter_<CharT>> split(
+    ::std::basic_string_view<CharT, Traits> str, any_of<CharT> set, split_options options = {}) noexcept
+{
+    return {str, {set.chars().data(), set.chars().size()}, options};
+}
+
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr basic_split_view<CharT, Traits, detail::char_delimiter_<CharT>> split(
+    basic_string<CharT, Traits, Allocator> const &str, ::std::type_identity_t<CharT> ch,
+    split_options options = {}) noexcept
+{
+    return split(::std::basic_string_view<CharT, Traits>(str), ch, options);
+}
+
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr basic_split_view<CharT, Traits, detail::string_delimiter_<CharT>> split(
+    basic_string<CharT, Traits, Allocator> const &str,
+    ::std::type_identity_t<::std::basic_string_view<CharT, Traits>> delimiter, split_options options = {}) noexcept
+{
+    return split(::std::basic_string_view<CharT, Traits>(str), delimiter, options);
+}
+
+template <typename CharT, typename Traits, typename Allocator>
+inline constexpr basic_split_view<CharT, Traits, detail::any_of_delimiter_<CharT>> split(
+    basic_string<CharT, Traits, Allocator> const &str, any_of<CharT> set, split_options options = {}) noexcept
+{
+    return split(::std::basic_string_view<CharT, Traits>(str), set, options);
+}
+
+// the fields would refer to a destroyed string
+template <typename CharT, typename Traits, typename Allocator, typename Delimiter>
+void split(basic_string<CharT, Traits, Allocator> const &&, Delimiter, split_options = {}) = delete;
+
+/**
+ * @brief concatenates the elements of rg with sep between them
+ * @brief the length of the result is computed first, so the result is allocated once
+ */
+template <typename CharT, typename Traits, ::std::ranges::forward_range R>
+    requires ::std::convertible_to<::std::ranges::range_reference_t<R>, ::std::basic_string_view<CharT, Traits>>
+inline constexpr basic_string<CharT, Traits> join(R &&rg, ::std::basic_string_view<CharT, Traits> sep)
+{
+    using view = ::std::basic_string_view<CharT, Traits>;
+    auto count = 0uz;
+    auto length = 0uz;
+
+    for (view const str : rg)
+    {
+        length += str.size();
+        ++count;
+    }
+
+    basic_string<CharT, Traits> result;
+
+    if (count == 0uz)
+        return result;
+
+    length += sep.size() * (count - 1uz);
+    result.resize_and_overwrite(length, [&](CharT *out, ::std::size_t) {
+        auto first = true;
+
+        for (view const str : rg)
+        {
+            if (!first)
+                out = ::std::ranges::copy(sep, out).out;
+
+            out = ::std::ranges::copy(str, out).out;
+            first = false;
+        }
+
+        return length;
+    });
+
+    return result;
+}
+
+template <::std::ranges::forward_range R, typename CharT>
+    requires ::std::convertible_to<::std::ranges::range_reference_t<R>, ::std::basic_string_view<CharT>>
+inline constexpr basic_string<CharT> join(R &&rg, CharT const *sep)
+{
+    return join<CharT, ::std::char_traits<CharT>>(rg, ::std::basic_string_view<CharT>(sep));
+}
+
+template <::std::ranges::forward_range R, typename CharT>
+    requires ::std::convertible_to<::std::ranges::range_reference_t<R>, ::std::basic_string_view<CharT>>
+inline constexpr basic_string<CharT> join(R &&rg, CharT sep)
+{
+    return join<CharT, ::std::char_traits<CharT>>(rg, ::std::basic_string_view<CharT>(&sep, 1uz));
+}
+} // namespace bizwen
+
+#endif
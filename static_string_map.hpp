@@ -0,0 +1,382 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_STATIC_STRING_MAP_HPP)
+#define BIZWEN_STATIC_STRING_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string.hpp"
+#include "fixed_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief Count strings with Size characters in total stored in one array, which is a structural type, so a set of
+ * @brief keys can be a template argument, as in static_string_map<{"GET", "POST"}, Value>
+ */
+template <typename CharT, ::std::size_t Count, ::std::size_t Size>
+struct basic_fixed_string_list
+{
+    /**
+     * @brief public because a structural type cannot have private members, use the member functions instead
+     */
+    CharT chars_[Size + 1uz]{};
+    ::std::size_t offsets_[Count + 1uz]{};
+
+    using value_type = ::std::basic_string_view<CharT>;
+    using size_type = ::std::size_t;
+
+    template <::std::size_t... N>
+        requires(sizeof...(N) == Count)
+    consteval basic_fixed_string_list(CharT const (&...strs)[N]) noexcept
+        : basic_fixed_string_list(basic_fixed_string<CharT, N - 1uz>(strs)...)
+    {
+    }
+
+    template <::std::size_t... N>
+        requires(sizeof...(N) == Count)
+    consteval basic_fixed_string_list(basic_fixed_string<CharT, N> const &...strs) noexcept
+    {
+        auto i = 0uz;
+        ((::std::ranges::copy(strs.view(), chars_ + offsets_[i]), offsets_[i + 1uz] = offsets_[i] + N, ++i), ...);
+    }
+
+    static constexpr size_type size() noexcept
+    {
+        return Count;
+    }
+
+    constexpr value_type operator[](size_type pos) const noexcept
+    {
+        return value_type(chars_ + offsets_[pos], offsets_[pos + 1uz] - offsets_[pos]);
+    }
+};
+
+template <typename CharT, ::std::size_t... N>
+basic_fixed_string_list(CharT const (&...strs)[N])
+    -> basic_fixed_string_list<CharT, sizeof...(N), (0uz + ... + (N - 1uz))>;
+
+template <typename CharT, ::std::size_t... N>
+basic_fixed_string_list(basic_fixed_string<CharT, N> const &...strs)
+    -> basic_fixed_string_list<CharT, sizeof...(N), (0uz + ... + N)>;
+
+namespace detail
+{
+inline constexpr ::std::uint64_t static_hash_mix_(::std::uint64_t x) noexcept
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdu;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53u;
+    x ^= x >> 33;
+
+    return x;
+}
+
+/**
+ * @brief hashes 8 bytes of code units at a time, at run time a full word is read with one load on little-endian
+ * @brief platforms, which gives the same value as assembling it from the code units
+ */
+template <typename CharT>
+inline constexpr ::std::uint64_t static_hash_(CharT const *str, ::std::size_t size, ::std::uint64_t seed) noexcept
+{
+    using unsigned_type = ::std::make_unsigned_t<CharT>;
+
+    constexpr auto units = 8uz / sizeof(CharT);
+    auto hash = seed ^ size * 0x9e3779b97f4a7c15u;
+
+    for (auto i = 0uz; i < size; i += units)
+    {
+        auto const count = ::std::ranges::min(units, size - i);
+        ::std::uint64_t word{};
+        auto loaded = false;
+
+        if !consteval
+        {
+            if constexpr (::std::endian::native == ::std::endian::little)
+            {
+                if (count == units)
+                {
+                    ::std::memcpy(&word, str + i, 8uz);
+                    loaded = true;
+                }
+            }
+        }
+
+        for (auto j = 0uz; !loaded && j != count; ++j)
+            word |= static_cast<::std::uint64_t>(static_cast<unsigned_type>(str[i + j])) << (j * sizeof(CharT) * 8uz);
+
+        hash = (hash ^ word) * 0xbf58476d1ce4e5b9u;
+        hash ^= hash >> 31;
+    }
+
+    return static_hash_mix_(hash);
+}
+
+/**
+ * @brief a minimal-probe perfect hash of Count keys built with hash and displace, see Belazzougui, Botelho and
+ * @brief Dietzfelbinger, Hash, displace, and compress
+ * @brief a key hashes to a bucket, the displacement of the bucket moves all of its keys to free slots, and the
+ * @brief displacement is applied to the hash value, so a lookup hashes the string once
+ */
+template <::std::size_t Count>
+struct perfect_hash_
+{
+    static inline constexpr ::std::size_t bucket_count{::std::bit_ceil(Count)};
+
+    /**
+     * @brief at most half of the slots are used, so the displacement of a bucket is found in a few tries
+     */
+    static inline constexpr ::std::size_t slot_count{bucket_count * 2uz};
+    static inline constexpr ::std::uint32_t empty{::std::numeric_limits<::std::uint32_t>::max()};
+
+    ::std::uint64_t seed{};
+    ::std::array<::std::uint64_t, bucket_count> displacements{};
+    ::std::array<::std::uint32_t, slot_count> slots{};
+
+    static constexpr ::std::size_t bucket_of(::std::uint64_t hash) noexcept
+    {
+        return static_cast<::std::size_t>(hash >> 32) & (bucket_count - 1uz);
+    }
+
+    constexpr ::std::size_t slot_of(::std::uint64_t hash) const noexcept
+    {
+        return static_cast<::std::size_t>(static_hash_mix_(hash ^ displacements[bucket_of(hash)])) & (slot_count - 1uz);
+    }
+
+    /**
+     * @return index of the only key which can be equal to str, or empty
+     */
+    template <typename CharT>
+    constexpr ::std::uint32_t find(::std::basic_string_view<CharT> str) const noexcept
+    {
+        return slots[slot_of(static_hash_(str.data(), str.size(), seed))];
+    }
+
+    /**
+     * @brief the buckets are placed from the largest, a failed bucket retries with the next seed
+     * @throw std::invalid_argument if two keys are equal, which makes the build not a constant expression
+     */
+    template <typename List>
+    constexpr bool build(List const &keys, ::std::uint64_t new_seed)
+    {
+        seed = new_seed;
+        displacements.fill(0u);
+        slots.fill(empty);
+
+        ::std::array<::std::uint64_t, Count> hashes{};
+        ::std::array<::std::size_t, bucket_count + 1uz> first{};
+        ::std::array<::std::size_t, Count> order{};
+
+        for (auto i = 0uz; i != Count; ++i)
+        {
+            hashes[i] = static_hash_(keys[i].data(), keys[i].size(), seed);
+            ++first[bucket_of(hashes[i]) + 1uz];
+        }
+
+        for (auto i = 1uz; i != first.size(); ++i)
+            first[i] += first[i - 1uz];
+
+        auto positions = first;
+
+        for (auto i = 0uz; i != Count; ++i)
+            order[positions[bucket_of(hashes[i])]++] = i;
+
+        ::std::array<::std::size_t, bucket_count> buckets{};
+
+        for (auto i = 0uz; i != bucket_count; ++i)
+            buckets[i] = i;
+
+        ::std::ranges::sort(buckets, [&first](::std::size_t lhs, ::std::size_t rhs) {
+            return first[lhs + 1uz] - first[lhs] > first[rhs + 1uz] - first[rhs];
+        });
+
+        for (auto const bucket : buckets)
+        {
+            auto const begin = first[bucket];
+            auto const end = first[bucket + 1uz];
+
+            if (begin == end)
+                break;
+
+            // keys with equal hashes are never separated by a displacement
+            for (auto i = begin; i != end; ++i)
+            {
+                for (auto j = begin; j != i; ++j)
+                {
+                    if (hashes[order[i]] != hashes[order[j]])
+                        continue;
+
+                    if (keys[order[i]] == keys[order[j]])
+                        throw ::std::invalid_argument("the keys of static_string_map are not distinct.");
+
+                    return false;
+                }
+            }
+
+            auto placed = false;
+
+            for (::std::uint64_t displacement = 1u; !placed && displacement != 1u << 16; ++displacement)
+            {
+                displacements[bucket] = displacement;
+                auto i = begin;
+
+                for (; i != end; ++i)
+                {
+                    auto &slot = slots[slot_of(hashes[order[i]])];
+
+                    if (slot != empty)
+                        break;
+
+                    slot = static_cast<::std::uint32_t>(order[i]);
+                }
+
+                placed = i == end;
+
+                // undo the keys placed by this displacement
+                for (auto j = begin; !placed && j != i; ++j)
+                    slots[slot_of(hashes[order[j]])] = empty;
+            }
+
+            if (!placed)
+                return false;
+        }
+
+        return true;
+    }
+};
+} // namespace detail
+
+/**
+ * @brief a map from a set of strings known at compile time to values, the perfect hash is built at compile time,
+ * @brief so a lookup hashes the string once and compares it with one key
+ * @brief the values are members of the map and can be modified, the keys are part of the type
+ */
+template <basic_fixed_string_list Keys, typename Value>
+class static_string_map
+{
+    using keys_type_ = ::std::remove_cvref_t<decltype(Keys)>;
+    using char_type_ = ::std::remove_cvref_t<decltype(Keys.chars_[0])>;
+
+    static inline constexpr ::std::size_t count_{keys_type_::size()};
+
+    static inline constexpr detail::perfect_hash_<count_> hash_{[] {
+        detail::perfect_hash_<count_> hash;
+
+        for (::std::uint64_t seed{}; !hash.build(Keys, seed); ++seed)
+        {
+        }
+
+        return hash;
+    }()};
+
+    ::std::array<Value, count_> values_{};
+
+  public:
+    using key_type = ::std::basic_string_view<char_type_>;
+    using mapped_type = Value;
+    using size_type = ::std::size_t;
+
+    static inline constexpr size_type npos{static_cast<size_type>(-1)};
+
+    constexpr static_string_map() = default;
+
+    /**
+     * @param values, values[i] is the value of the i-th key
+     */
+    constexpr explicit static_string_map(::std::array<Value, count_> const &values) : values_(values)
+    {
+    }
+
+    static constexpr size_type size() noexcept
+    {
+        return count_;
+    }
+
+    static constexpr key_type key(size_type index) noexcept
+    {
+        return Keys[index];
+    }
+
+    /**
+     * @return index of str in the keys, or npos
+     */
+    static constexpr size_type index_of(key_type str) noexcept
+    {
+        auto const index = hash_.find(str);
+
+        if (index == hash_.empty || Keys[index] != str)
+            return npos;
+
+        return index;
+    }
+
+    static constexpr bool contains(key_type str) noexcept
+    {
+        return index_of(str) != npos;
+    }
+
+    /**
+     * @return pointer to the value of str, or nullptr if str is not a key
+     */
+    constexpr Value const *find(key_type str) const noexcept
+    {
+        auto const index = index_of(str);
+
+        return index == npos ? nullptr : &values_[index];
+    }
+
+    constexpr Value *find(key_type str) noexcept
+    {
+        auto const index = index_of(str);
+
+        return index == npos ? nullptr : &values_[index];
+    }
+
+    /**
+     * @throw std::out_of_range if str is not a key
+     */
+    constexpr Value const &at(key_type str) const
+    {
+        auto const index = index_of(str);
+
+        if (index == npos)
+            throw ::std::out_of_range("str is not a key of static_string_map.");
+
+        return values_[index];
+    }
+
+    constexpr Value &at(key_type str)
+    {
+        auto const index = index_of(str);
+
+        if (index == npos)
+            throw ::std::out_of_range("str is not a key of static_string_map.");
+
+        return values_[index];
+    }
+
+    constexpr Value const &operator[](size_type index) const noexcept
+    {
+        return values_[index];
+    }
+
+    constexpr Value &operator[](size_type index) noexcept
+    {
+        return values_[index];
+    }
+};
+} // namespace bizwen
+
+#endif
@@ -0,0 +1,468 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_STRING_COLUMN_HPP)
+#define BIZWEN_STRING_COLUMN_HPP
+
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a sequence of strings stored in one character buffer, the i-th string is
+ * @brief [offsets()[i], offsets()[i + 1]) of chars(), so an element costs one offset instead of a basic_string and
+ * @brief a scan reads the characters sequentially
+ * @brief elements are accessed as views, which are invalidated by every modification, like iterators of a vector
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>, typename Allocator = ::std::allocator<CharT>>
+class basic_string_column
+{
+  public:
+    using value_type = ::std::basic_string_view<CharT, Traits>;
+    using string_type = basic_string<CharT, Traits, Allocator>;
+    using allocator_type = Allocator;
+    using size_type = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+
+  private:
+    using offsets_type_ =
+        ::std::vector<size_type, typename ::std::allocator_traits<Allocator>::template rebind_alloc<size_type>>;
+
+    string_type chars_;
+
+    /**
+     * @brief size() + 1 offsets, the first is always 0
+     */
+    offsets_type_ offsets_;
+
+    /**
+     * @brief use size * 1.5 for growth, append() of basic_string allocates exactly
+     */
+    constexpr void grow_chars_(size_type count)
+    {
+        auto const size = chars_.size();
+        auto const cap = chars_.capacity();
+
+        if (cap - size < count)
+            chars_.reserve(::std::ranges::max(size + count, cap * 2uz - cap / 2uz));
+    }
+
+    /**
+     * @brief use size * 2 for growth, so the offsets of a push_back are never reallocated one by one
+     */
+    constexpr void grow_offsets_(size_type count)
+    {
+        auto const size = offsets_.size();
+        auto const cap = offsets_.capacity();
+
+        if (cap - size < count)
+            offsets_.reserve(::std::ranges::max(size + count, cap * 2uz));
+    }
+
+  public:
+    /**
+     * @brief a random access iterator whose reference is a view
+     */
+    class iterator
+    {
+        basic_string_column const *column_{};
+        size_type index_{};
+
+        friend basic_string_column;
+
+        constexpr iterator(basic_string_column const *column, size_type index) noexcept
+            : column_(column), index_(index)
+        {
+        }
+
+      public:
+        using value_type = ::std::basic_string_view<CharT, Traits>;
+        using difference_type = ::std::ptrdiff_t;
+        using iterator_concept = ::std::random_access_iterator_tag;
+        using iterator_category = ::std::input_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr value_type operator*() const noexcept
+        {
+            return (*column_)[index_];
+        }
+
+        constexpr value_type operator[](difference_type n) const noexcept
+        {
+            return (*column_)[static_cast<size_type>(static_cast<difference_type>(index_) + n)];
+        }
+
+        constexpr iterator &operator++() noexcept
+        {
+            ++index_;
+
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++index_;
+
+            return temp;
+        }
+
+        constexpr iterator &operator--() noexcept
+        {
+            --index_;
+
+            return *this;
+        }
+
+        constexpr iterator operator--(int) noexcept
+        {
+            auto temp = *this;
+            --index_;
+
+            return temp;
+        }
+
+        constexpr iterator &operator+=(difference_type n) noexcept
+        {
+            index_ = static_cast<size_type>(static_cast<difference_type>(index_) + n);
+
+            return *this;
+        }
+
+        constexpr iterator &operator-=(difference_type n) noexcept
+        {
+            return *this += -n;
+        }
+
+        friend constexpr iterator operator+(iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator+(difference_type n, iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend constexpr iterator operator-(iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend constexpr difference_type operator-(iterator const &lhs, iterator const &rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend constexpr bool operator==(iterator const &lhs, iterator const &rhs) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend constexpr ::std::strong_ordering operator<=>(iterator const &lhs, iterator const &rhs) noexcept
+        {
+            return lhs.index_ <=> rhs.index_;
+        }
+    };
+
+    using const_iterator = iterator;
+
+    constexpr basic_string_column() : basic_string_column(Allocator())
+    {
+    }
+
+    constexpr explicit basic_string_column(Allocator const &a)
+        : chars_(a), offsets_(1uz, 0uz, typename offsets_type_::allocator_type(a))
+    {
+    }
+
+    /**
+     * @brief copies the elements of rg, the characters are counted first, so the buffer is allocated once
+     */
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type> &&
+                 (!::std::same_as<::std::remove_cvref_t<R>, basic_string_column>)
+    constexpr explicit basic_string_column(R &&rg, Allocator const &a = Allocator()) : basic_string_column(a)
+    {
+        append_range(::std::forward<R>(rg));
+    }
+
+    constexpr basic_string_column(::std::initializer_list<value_type> il, Allocator const &a = Allocator())
+        : basic_string_column(a)
+    {
+        append_range(il);
+    }
+
+    constexpr allocator_type get_allocator() const noexcept
+    {
+        return chars_.get_allocator();
+    }
+
+    constexpr size_type size() const noexcept
+    {
+        return offsets_.size() - 1uz;
+    }
+
+    constexpr bool empty() const noexcept
+    {
+        return offsets_.size() == 1uz;
+    }
+
+    /**
+     * @return total number of characters of the elements
+     */
+    constexpr size_type chars_size() const noexcept
+    {
+        return chars_.size();
+    }
+
+    /**
+     * @return the characters of all elements concatenated
+     */
+    constexpr value_type chars() const noexcept
+    {
+        return chars_;
+    }
+
+    /**
+     * @return size() + 1 offsets into chars(), the first is 0 and the last is chars_size()
+     */
+    constexpr ::std::span<size_type const> offsets() const noexcept
+    {
+        return offsets_;
+    }
+
+    /**
+     * @param count, number of elements
+     * @param chars, total number of characters of the elements
+     */
+    constexpr void reserve(size_type count, size_type chars)
+    {
+        offsets_.reserve(count + 1uz);
+        chars_.reserve(chars);
+    }
+
+    constexpr void shrink_to_fit()
+    {
+        offsets_.shrink_to_fit();
+        chars_.shrink_to_fit();
+    }
+
+    constexpr value_type operator[](size_type pos) const noexcept
+    {
+        return value_type(chars_.data() + offsets_[pos], offsets_[pos + 1uz] - offsets_[pos]);
+    }
+
+    constexpr value_type at(size_type pos) const
+    {
+        if (pos >= size())
+            throw ::std::out_of_range("pos is out of range, please check it.");
+
+        return (*this)[pos];
+    }
+
+    constexpr value_type front() const noexcept
+    {
+        return (*this)[0uz];
+    }
+
+    constexpr value_type back() const noexcept
+    {
+        return (*this)[size() - 1uz];
+    }
+
+    constexpr iterator begin() const noexcept
+    {
+        return {this, 0uz};
+    }
+
+    constexpr iterator end() const noexcept
+    {
+        return {this, size()};
+    }
+
+    constexpr iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    constexpr iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    /**
+     * @param str, which may be an element of *this
+     */
+    constexpr void push_back(value_type str)
+    {
+        // the push_back of the offset cannot throw after str is appended
+        grow_offsets_(1uz);
+
+        if (chars_.capacity() - chars_.size() < str.size())
+        {
+            // str may refer to chars_, which is reallocated
+            string_type temp(str, chars_.get_allocator());
+            grow_chars_(temp.size());
+            chars_.append(temp);
+        }
+        else
+        {
+            chars_.append(str);
+        }
+
+        offsets_.push_back(chars_.size());
+    }
+
+    constexpr void pop_back() noexcept
+    {
+        offsets_.pop_back();
+        chars_.resize(offsets_.back());
+    }
+
+    /**
+     * @brief appends the elements of rg, a forward range is measured first, so the buffers grow at most once, and
+     * @brief geometrically, so appending many small ranges is linear
+     */
+    template <::std::ranges::input_range R>
+        requires ::std::convertible_to<::std::ranges::range_reference_t<R>, value_type>
+    constexpr void append_range(R &&rg)
+    {
+        if constexpr (::std::ranges::forward_range<R>)
+        {
+            auto count = 0uz;
+            auto chars = 0uz;
+
+            for (value_type const str : rg)
+            {
+                ++count;
+                chars += str.size();
+            }
+
+            grow_offsets_(count);
+            grow_chars_(chars);
+        }
+
+        for (value_type const str : rg)
+            push_back(str);
+    }
+
+    constexpr void clear() noexcept
+    {
+        chars_.clear();
+        offsets_.resize(1uz);
+    }
+
+    constexpr void swap(basic_string_column &other) noexcept
+    {
+        chars_.swap(other.chars_);
+        offsets_.swap(other.offsets_);
+    }
+
+    friend constexpr void swap(basic_string_column &lhs, basic_string_column &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /**
+     * @return indices of the elements in the order given by comp, the column is not modified
+     */
+    template <typename Compare = ::std::ranges::less>
+    constexpr ::std::vector<size_type> sort_permutation(Compare comp = {}) const
+    {
+        ::std::vector<size_type> permutation(size());
+
+        for (auto i = 0uz; i != permutation.size(); ++i)
+            permutation[i] = i;
+
+        ::std::ranges::sort(permutation, ::std::ref(comp), [this](size_type i) { return (*this)[i]; });
+
+        return permutation;
+    }
+
+    /**
+     * @brief rearranges the elements so that the i-th element is the permutation[i]-th element before
+     * @brief the characters are copied once into a new buffer
+     * @param permutation, which has size() indices, an index may repeat, which copies that element
+     */
+    constexpr void permute(::std::span<size_type const> permutation)
+    {
+        string_type chars(chars_.get_allocator());
+        offsets_type_ offsets(offsets_.get_allocator());
+        auto length = 0uz;
+
+        for (auto const i : permutation)
+            length += offsets_[i + 1uz] - offsets_[i];
+
+        offsets.reserve(permutation.size() + 1uz);
+        offsets.push_back(0uz);
+        chars.resize_and_overwrite(length, [&](CharT *out, ::std::size_t) {
+            auto const first = out;
+
+            for (auto const i : permutation)
+            {
+                out = ::std::ranges::copy((*this)[i], out).out;
+                offsets.push_back(static_cast<size_type>(out - first));
+            }
+
+            return length;
+        });
+        chars_ = ::std::move(chars);
+        offsets_ = ::std::move(offsets);
+    }
+
+    /**
+     * @brief sorts by a permutation of the indices, so the characters are moved once rather than at every swap
+     */
+    template <typename Compare = ::std::ranges::less>
+    constexpr void sort(Compare comp = {})
+    {
+        permute(sort_permutation(::std::move(comp)));
+    }
+
+    /**
+     * @return the elements as separate strings, which use the allocator of *this
+     */
+    constexpr ::std::vector<string_type> to_vector() const
+    {
+        ::std::vector<string_type> result;
+        result.reserve(size());
+
+        for (value_type const str : *this)
+            result.emplace_back(str, chars_.get_allocator());
+
+        return result;
+    }
+
+    friend constexpr bool operator==(basic_string_column const &lhs, basic_string_column const &rhs) noexcept
+    {
+        return lhs.offsets_ == rhs.offsets_ && lhs.chars_ == rhs.chars_;
+    }
+};
+
+using string_column = basic_string_column<char>;
+using wstring_column = basic_string_column<wchar_t>;
+using u8string_column = basic_string_column<char8_t>;
+using u16string_column = basic_string_column<char16_t>;
+using u32string_column = basic_string_column<char32_t>;
+} // namespace bizwen
+
+#endif
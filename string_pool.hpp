@@ -0,0 +1,331 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_STRING_POOL_HPP)
+#define BIZWEN_STRING_POOL_HPP
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+/**
+ * @brief a handle to a string interned by a basic_string_pool, ids are assigned in the order of interning
+ * @brief two ids of the same pool are equal if and only if their strings are equal
+ */
+class string_id
+{
+    ::std::uint32_t value_{};
+
+  public:
+    constexpr string_id() noexcept = default;
+
+    constexpr explicit string_id(::std::uint32_t value) noexcept : value_(value)
+    {
+    }
+
+    constexpr ::std::uint32_t value() const noexcept
+    {
+        return value_;
+    }
+
+    friend constexpr bool operator==(string_id, string_id) noexcept = default;
+    friend constexpr ::std::strong_ordering operator<=>(string_id, string_id) noexcept = default;
+};
+
+/**
+ * @brief intern_count and interned_size are the number of calls of intern() and the sum of their lengths,
+ * @brief string_count and string_size are the number of distinct strings and the sum of their lengths,
+ * @brief page_count and page_bytes are the arena pages holding the distinct strings
+ * @brief sizes are in characters, page_bytes is in bytes and includes the null terminators and the unused tails
+ */
+struct string_pool_stats
+{
+    ::std::size_t intern_count;
+    ::std::size_t interned_size;
+    ::std::size_t string_count;
+    ::std::size_t string_size;
+    ::std::size_t page_count;
+    ::std::size_t page_bytes;
+};
+
+namespace detail
+{
+/**
+ * @brief hashes every string type convertible to the view, so lookups do not construct a key
+ */
+template <typename CharT, typename Traits>
+struct transparent_string_hash_
+{
+    using is_transparent = void;
+
+    ::std::size_t operator()(::std::basic_string_view<CharT, Traits> str) const noexcept
+    {
+        return ::std::hash<::std::basic_string_view<CharT>>{}(::std::basic_string_view<CharT>(str.data(), str.size()));
+    }
+};
+
+/**
+ * @brief copies strings into large pages, strings longer than half a page get a page of their own, so the unused
+ * @brief tail of a page is bounded, the copies are null terminated and never move
+ */
+template <typename CharT, typename Traits>
+class string_arena_
+{
+    ::std::size_t page_size_{};
+    ::std::vector<::std::unique_ptr<CharT[]>> pages_;
+    ::std::size_t page_bytes_{};
+
+    /**
+     * @brief free characters of the current page
+     */
+    CharT *free_{};
+    ::std::size_t free_size_{};
+
+    CharT *new_page_(::std::size_t size)
+    {
+        pages_.push_back(::std::make_unique_for_overwrite<CharT[]>(size));
+        page_bytes_ += size * sizeof(CharT);
+
+        return pages_.back().get();
+    }
+
+  public:
+    explicit string_arena_(::std::size_t page_size) noexcept : page_size_(page_size)
+    {
+    }
+
+    string_arena_(string_arena_ &&other) noexcept
+        : page_size_(other.page_size_), pages_(::std::move(other.pages_)),
+          page_bytes_(::std::exchange(other.page_bytes_, 0uz)), free_(::std::exchange(other.free_, nullptr)),
+          free_size_(::std::exchange(other.free_size_, 0uz))
+    {
+    }
+
+    string_arena_ &operator=(string_arena_ &&other) noexcept
+    {
+        page_size_ = other.page_size_;
+        pages_ = ::std::move(other.pages_);
+        page_bytes_ = ::std::exchange(other.page_bytes_, 0uz);
+        // other must not write into the pages it no longer owns
+        free_ = ::std::exchange(other.free_, nullptr);
+        free_size_ = ::std::exchange(other.free_size_, 0uz);
+
+        return *this;
+    }
+
+    /**
+     * @return a null terminated copy of str
+     */
+    ::std::basic_string_view<CharT, Traits> store(::std::basic_string_view<CharT, Traits> str)
+    {
+        auto const size = str.size() + 1uz;
+        CharT *data{};
+
+        if (size <= free_size_)
+        {
+            data = free_;
+            free_ += size;
+            free_size_ -= size;
+        }
+        else if (size > page_size_ / 2uz)
+        {
+            // the current page keeps its free characters for the next short strings
+            data = new_page_(size);
+        }
+        else
+        {
+            data = new_page_(page_size_);
+            free_ = data + size;
+            free_size_ = page_size_ - size;
+        }
+
+        Traits::copy(data, str.data(), str.size());
+        data[str.size()] = CharT{};
+
+        return {data, str.size()};
+    }
+
+    ::std::size_t page_count() const noexcept
+    {
+        return pages_.size();
+    }
+
+    ::std::size_t page_bytes() const noexcept
+    {
+        return page_bytes_;
+    }
+};
+} // namespace detail
+
+/**
+ * @brief stores every distinct string once, in large arena pages, and identifies it by a 32-bit string_id
+ * @brief the strings are null terminated and never move, so views and c_str() stay valid until the pool is destroyed
+ */
+template <typename CharT, typename Traits = ::std::char_traits<CharT>>
+class basic_string_pool
+{
+    using view_type_ = ::std::basic_string_view<CharT, Traits>;
+
+    detail::string_arena_<CharT, Traits> arena_;
+
+    /**
+     * @brief strings_[id] is the string of id
+     */
+    ::std::vector<view_type_> strings_;
+    ::std::unordered_map<view_type_, ::std::uint32_t, detail::transparent_string_hash_<CharT, Traits>,
+                         ::std::equal_to<>>
+        index_;
+    ::std::size_t intern_count_{};
+    ::std::size_t interned_size_{};
+    ::std::size_t string_size_{};
+
+  public:
+    using id_type = string_id;
+    using view_type = view_type_;
+
+    static inline constexpr ::std::size_t default_page_size{(1uz << 16) / sizeof(CharT)};
+
+    /**
+     * @param page_size, number of characters of a page
+     */
+    explicit basic_string_pool(::std::size_t page_size = default_page_size) : arena_(page_size)
+    {
+    }
+
+    basic_string_pool(basic_string_pool const &) = delete;
+    basic_string_pool &operator=(basic_string_pool const &) = delete;
+
+    /**
+     * @brief the pages and the strings are moved, so views and ids of other stay valid and refer to *this
+     */
+    basic_string_pool(basic_string_pool &&) noexcept = default;
+    basic_string_pool &operator=(basic_string_pool &&) noexcept = default;
+
+    /**
+     * @return id of str, str is copied into the pool if it was not interned before
+     * @throw std::length_error if the pool already holds 2^32 - 1 strings
+     */
+    id_type intern(view_type str)
+    {
+        ++intern_count_;
+        interned_size_ += str.size();
+
+        if (auto const it = index_.find(str); it != index_.end())
+            return id_type{it->second};
+
+        if (strings_.size() == static_cast<::std::uint32_t>(-1))
+            throw ::std::length_error("too many strings in basic_string_pool.");
+
+        auto const id = static_cast<::std::uint32_t>(strings_.size());
+
+        // the push_back below cannot throw after str is in the index, the capacity grows geometrically
+        if (strings_.size() == strings_.capacity())
+            strings_.reserve(::std::ranges::max(strings_.capacity() * 2uz, strings_.size() + 1uz));
+
+        auto const stored = arena_.store(str);
+        index_.emplace(stored, id);
+        strings_.push_back(stored);
+        string_size_ += str.size();
+
+        return id_type{id};
+    }
+
+    /**
+     * @return id of str if it was interned, str is never inserted
+     */
+    ::std::optional<id_type> find(view_type str) const
+    {
+        if (auto const it = index_.find(str); it != index_.end())
+            return id_type{it->second};
+
+        return ::std::nullopt;
+    }
+
+    bool contains(view_type str) const
+    {
+        return index_.contains(str);
+    }
+
+    /**
+     * @param id, which was returned by this pool
+     */
+    view_type view(id_type id) const noexcept
+    {
+        return strings_[id.value()];
+    }
+
+    view_type operator[](id_type id) const noexcept
+    {
+        return strings_[id.value()];
+    }
+
+    CharT const *c_str(id_type id) const noexcept
+    {
+        return strings_[id.value()].data();
+    }
+
+    /**
+     * @return number of distinct strings
+     */
+    ::std::size_t size() const noexcept
+    {
+        return strings_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return strings_.empty();
+    }
+
+    /**
+     * @brief reserves the index for count distinct strings, the pages are allocated on demand
+     */
+    void reserve(::std::size_t count)
+    {
+        strings_.reserve(count);
+        index_.reserve(count);
+    }
+
+    string_pool_stats stats() const noexcept
+    {
+        return {intern_count_, interned_size_, strings_.size(), string_size_, arena_.page_count(), arena_.page_bytes()};
+    }
+};
+
+using string_pool = basic_string_pool<char>;
+using wstring_pool = basic_string_pool<wchar_t>;
+using u8string_pool = basic_string_pool<char8_t>;
+using u16string_pool = basic_string_pool<char16_t>;
+using u32string_pool = basic_string_pool<char32_t>;
+} // namespace bizwen
+
+namespace std
+{
+/**
+ * @brief the id is already unique within its pool, so it is its own hash
+ */
+template <>
+struct hash<bizwen::string_id>
+{
+    static constexpr ::std::size_t operator()(bizwen::string_id id) noexcept
+    {
+        return id.value();
+    }
+};
+} // namespace std
+
+#endif
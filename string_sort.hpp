@@ -0,0 +1,379 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_STRING_SORT_HPP)
+#define BIZWEN_STRING_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <ranges>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "basic_string.hpp"
+
+namespace bizwen
+{
+namespace detail
+{
+template <typename CharT>
+struct sort_item_
+{
+    CharT const *data;
+    ::std::size_t size;
+    ::std::size_t index;
+
+    /**
+     * @brief bytes [depth / 8 * 8, depth / 8 * 8 + 8) of the key at the depth of the item, in big-endian order, so
+     * @brief a level reads the item instead of the string
+     */
+    ::std::uint64_t prefix;
+};
+
+template <typename CharT>
+struct sort_task_
+{
+    sort_item_<CharT> *first;
+    sort_item_<CharT> *last;
+
+    /**
+     * @brief the items agree on the first depth bytes of their keys
+     */
+    ::std::size_t depth;
+};
+
+/**
+ * @brief buckets smaller than this are sorted by comparison
+ */
+inline constexpr ::std::size_t radix_sort_threshold_{32uz};
+
+/**
+ * @brief the key of a string is its code units in big-endian order, signed code units other than char have the sign
+ * @brief bit flipped, so the keys order like std::char_traits<CharT>::lt, which compares char as unsigned char
+ * @return the bytes of the key of ch
+ */
+template <typename CharT>
+inline ::std::uint64_t key_unit_(CharT ch) noexcept
+{
+    using unsigned_type = ::std::make_unsigned_t<CharT>;
+
+    auto value = static_cast<unsigned_type>(ch);
+
+    if constexpr (::std::is_signed_v<CharT> && !::std::same_as<CharT, char>)
+        value ^= static_cast<unsigned_type>(unsigned_type(1) << (sizeof(CharT) * 8uz - 1uz));
+
+    return value;
+}
+
+/**
+ * @param depth, a multiple of 8
+ * @return bytes [depth, depth + 8) of the key of [data, data + size), the bytes after the end are 0
+ */
+template <typename CharT>
+inline ::std::uint64_t sort_prefix_(CharT const *data, ::std::size_t size, ::std::size_t depth) noexcept
+{
+    constexpr auto units = 8uz / sizeof(CharT);
+    auto const first = depth / sizeof(CharT);
+
+    if constexpr (sizeof(CharT) == 1uz && ::std::endian::native == ::std::endian::little)
+    {
+        if (first < size && size - first >= units)
+        {
+            ::std::uint64_t prefix;
+            ::std::memcpy(&prefix, data + first, 8uz);
+
+            return ::std::byteswap(prefix);
+        }
+    }
+
+    ::std::uint64_t prefix{};
+
+    for (auto i = 0uz; i != units; ++i)
+    {
+        prefix <<= sizeof(CharT) * 8uz;
+
+        if (first + i < size)
+            prefix |= key_unit_(data[first + i]);
+    }
+
+    return prefix;
+}
+
+/**
+ * @brief the byte is read from the cached prefix of the item, which holds the block of 8 bytes containing depth
+ * @return 0 if the string ends before byte depth of its key, otherwise 1 + the byte
+ */
+template <typename CharT>
+inline unsigned radix_digit_(sort_item_<CharT> const &item, ::std::size_t depth) noexcept
+{
+    if (depth / sizeof(CharT) >= item.size)
+        return 0u;
+
+    return 1u + static_cast<unsigned>(item.prefix >> ((7uz - depth % 8uz) * 8uz) & 0xffu);
+}
+
+/**
+ * @brief stable sort of a small bucket, the code units before depth are equal, so they are skipped
+ */
+template <typename CharT>
+inline void small_sort_(sort_task_<CharT> task)
+{
+    using view = ::std::basic_string_view<CharT>;
+
+    auto const unit = task.depth / sizeof(CharT);
+    ::std::stable_sort(task.first, task.last, [unit](sort_item_<CharT> const &lhs, sort_item_<CharT> const &rhs) {
+        return view(lhs.data + unit, lhs.size - unit) < view(rhs.data + unit, rhs.size - unit);
+    });
+}
+
+/**
+ * @brief distributes the items of task to 257 buckets by the byte at its depth with a counting sort, which is
+ * @brief stable, the digits of a level are computed once from the cached prefixes, which are reloaded from the
+ * @brief strings when the depth enters the next block of 8 bytes, so every string is read once per 8 levels
+ * @brief a level where all items fall into the same bucket is skipped without moving them
+ * @param buffer, digits, scratch space for the items of task
+ * @param push, called with the buckets which need to be sorted by the next byte
+ */
+template <typename CharT, typename Push>
+inline void radix_partition_(sort_task_<CharT> task, sort_item_<CharT> *buffer, ::std::uint16_t *digits, Push push)
+{
+    auto const size = static_cast<::std::size_t>(task.last - task.first);
+    ::std::array<::std::size_t, 257uz> counts{};
+
+    for (;;)
+    {
+        counts.fill(0uz);
+
+        // every item passes each depth once, the prefixes of depth 0 are loaded by make_sort_items_
+        auto const reload = task.depth % 8uz == 0uz && task.depth != 0uz;
+
+        for (auto i = 0uz; i != size; ++i)
+        {
+            auto &item = task.first[i];
+
+            if (reload)
+                item.prefix = sort_prefix_(item.data, item.size, task.depth);
+
+            digits[i] = static_cast<::std::uint16_t>(radix_digit_(item, task.depth));
+            ++counts[digits[i]];
+        }
+
+        // every key ended, so the items are equal
+        if (counts[0] == size)
+            return;
+
+        if (counts[digits[0]] != size)
+            break;
+
+        ++task.depth;
+    }
+
+    ::std::array<::std::size_t, 257uz> offsets{};
+
+    for (auto i = 1uz; i != offsets.size(); ++i)
+        offsets[i] = offsets[i - 1uz] + counts[i - 1uz];
+
+    auto positions = offsets;
+
+    for (auto i = 0uz; i != size; ++i)
+        buffer[positions[digits[i]]++] = task.first[i];
+
+    ::std::ranges::copy(buffer, buffer + size, task.first);
+
+    // bucket 0 holds the strings which ended, they are equal and already in their original order
+    for (auto i = 1uz; i != counts.size(); ++i)
+    {
+        if (counts[i] > 1uz)
+            push(sort_task_<CharT>{task.first + offsets[i], task.first + offsets[i] + counts[i], task.depth + 1uz});
+    }
+}
+
+/**
+ * @brief sorts the tasks with an explicit stack, so a long common prefix does not nest calls
+ * @param base, the first item of the whole input, buffer and digits are indexed relative to it
+ */
+template <typename CharT>
+inline void radix_sort_(::std::vector<sort_task_<CharT>> stack, sort_item_<CharT> *base, sort_item_<CharT> *buffer,
+                        ::std::uint16_t *digits)
+{
+    while (!stack.empty())
+    {
+        auto const task = stack.back();
+        stack.pop_back();
+
+        if (static_cast<::std::size_t>(task.last - task.first) < radix_sort_threshold_)
+        {
+            small_sort_(task);
+
+            continue;
+        }
+
+        auto const offset = task.first - base;
+        radix_partition_(task, buffer + offset, digits + offset,
+                         [&stack](sort_task_<CharT> child) { stack.push_back(child); });
+    }
+}
+
+template <typename CharT, typename R>
+inline ::std::vector<sort_item_<CharT>> make_sort_items_(R &rg)
+{
+    ::std::vector<sort_item_<CharT>> items;
+    items.reserve(static_cast<::std::size_t>(::std::ranges::size(rg)));
+    auto index = 0uz;
+
+    for (auto &&element : rg)
+    {
+        ::std::basic_string_view<CharT> const str = element;
+        items.push_back({str.data(), str.size(), index++, sort_prefix_(str.data(), str.size(), 0uz)});
+    }
+
+    return items;
+}
+
+/**
+ * @param threads, 1 sorts on the calling thread
+ */
+template <typename CharT>
+inline void radix_sort_items_(::std::vector<sort_item_<CharT>> &items, ::std::size_t threads)
+{
+    auto const size = items.size();
+
+    if (size < 2uz)
+        return;
+
+    ::std::vector<sort_item_<CharT>> buffer(size);
+    ::std::vector<::std::uint16_t> digits(size);
+    auto const base = items.data();
+
+    if (threads <= 1uz)
+    {
+        radix_sort_(::std::vector<sort_task_<CharT>>{{base, base + size, 0uz}}, base, buffer.data(), digits.data());
+
+        return;
+    }
+
+    // split the buckets on this thread until they are small enough to balance the threads
+    auto const grain = ::std::ranges::max(size / (threads * 4uz), radix_sort_threshold_);
+    ::std::vector<sort_task_<CharT>> large{{base, base + size, 0uz}};
+    ::std::vector<sort_task_<CharT>> tasks;
+
+    while (!large.empty())
+    {
+        auto const task = large.back();
+        large.pop_back();
+        auto const offset = task.first - base;
+        radix_partition_(task, buffer.data() + offset, digits.data() + offset, [&](sort_task_<CharT> child) {
+            (static_cast<::std::size_t>(child.last - child.first) > grain ? large : tasks).push_back(child);
+        });
+    }
+
+    // the largest tasks first, so the threads finish at about the same time
+    ::std::ranges::sort(tasks, ::std::ranges::greater{},
+                        [](sort_task_<CharT> const &task) { return task.last - task.first; });
+
+    ::std::atomic<::std::size_t> next{};
+    auto const worker = [&] {
+        for (auto i = next.fetch_add(1uz, ::std::memory_order_relaxed); i < tasks.size();
+             i = next.fetch_add(1uz, ::std::memory_order_relaxed))
+            radix_sort_(::std::vector<sort_task_<CharT>>{tasks[i]}, base, buffer.data(), digits.data());
+    };
+
+    ::std::vector<::std::jthread> pool;
+    pool.reserve(threads - 1uz);
+
+    for (auto i = 1uz; i != threads; ++i)
+        pool.emplace_back(worker);
+
+    worker();
+}
+
+template <typename CharT, typename R>
+inline void apply_sort_items_(R &rg, ::std::vector<sort_item_<CharT>> const &items)
+{
+    using value_type = ::std::ranges::range_value_t<R>;
+
+    ::std::vector<value_type> sorted;
+    sorted.reserve(items.size());
+    auto const first = ::std::ranges::begin(rg);
+
+    for (auto const &item : items)
+        sorted.push_back(::std::ranges::iter_move(first + static_cast<::std::ptrdiff_t>(item.index)));
+
+    ::std::ranges::move(sorted, first);
+}
+
+template <typename R>
+using sort_char_t_ = typename ::std::ranges::range_value_t<R>::value_type;
+} // namespace detail
+
+/**
+ * @brief a random access range of strings or string views with std::char_traits
+ */
+template <typename R>
+concept string_sortable_range =
+    ::std::ranges::random_access_range<R> && ::std::ranges::sized_range<R> &&
+    requires { typename detail::sort_char_t_<R>; } &&
+    ::std::convertible_to<::std::ranges::range_reference_t<R>, ::std::basic_string_view<detail::sort_char_t_<R>>>;
+
+/**
+ * @brief a stable MSD radix sort of the keys of rg, see McIlroy, Bostic and McIlroy, Engineering Radix Sort
+ * @brief the keys are cached 8 bytes at a time next to data() and size(), so the strings are read once per 8 levels
+ * @brief the order is the order of operator< of std::basic_string_view, so char16_t and char32_t are ordered by code
+ * @brief unit
+ * @return the indices of the elements of rg in sorted order, rg is not modified
+ */
+template <string_sortable_range R>
+inline ::std::vector<::std::size_t> string_sort_permutation(R &&rg)
+{
+    using char_type = detail::sort_char_t_<R>;
+
+    auto items = detail::make_sort_items_<char_type>(rg);
+    detail::radix_sort_items_(items, 1uz);
+    ::std::vector<::std::size_t> permutation(items.size());
+    ::std::ranges::transform(items, permutation.begin(), &detail::sort_item_<char_type>::index);
+
+    return permutation;
+}
+
+/**
+ * @brief sorts rg stably, the keys are sorted first and the elements are moved once
+ */
+template <string_sortable_range R>
+    requires ::std::ranges::output_range<R, ::std::ranges::range_value_t<R>>
+inline void string_sort(R &&rg)
+{
+    using char_type = detail::sort_char_t_<R>;
+
+    auto items = detail::make_sort_items_<char_type>(rg);
+    detail::radix_sort_items_(items, 1uz);
+    detail::apply_sort_items_(rg, items);
+}
+
+/**
+ * @brief sorts rg stably with std::thread::hardware_concurrency() threads, the first levels are partitioned on the
+ * @brief calling thread and the buckets are sorted in parallel
+ */
+template <string_sortable_range R>
+    requires ::std::ranges::output_range<R, ::std::ranges::range_value_t<R>>
+inline void string_sort(::std::execution::parallel_policy const &, R &&rg)
+{
+    using char_type = detail::sort_char_t_<R>;
+
+    auto items = detail::make_sort_items_<char_type>(rg);
+    detail::radix_sort_items_(items, ::std::ranges::max(::std::thread::hardware_concurrency(), 1u));
+    detail::apply_sort_items_(rg, items);
+}
+} // namespace bizwen
+
+#endif
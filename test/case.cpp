@@ -0,0 +1,66 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+// g++ -std=c++23 -I.. case.cpp
+
+#include <cassert>
+#include <compare>
+#include <string_view>
+
+#include "../basic_string.hpp"
+
+namespace
+{
+void test_case_conversion()
+{
+    bizwen::string str("Content-Type: TEXT/html; charset=UTF-8 \xc3\x89");
+    str.to_ascii_lower();
+    assert(str == "content-type: text/html; charset=utf-8 \xc3\x89");
+    str.to_ascii_upper();
+    assert(str == "CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 \xc3\x89");
+}
+
+void test_icompare()
+{
+    using namespace ::std::string_view_literals;
+
+    bizwen::string const str("Content-Type");
+
+    // string literals
+    assert(iequals(str, "content-type"));
+    assert(iequals("CONTENT-TYPE", str));
+    assert(!iequals(str, "content-typ"));
+    assert(!iequals(str, "content-typf"));
+    assert(icompare(str, "content-type") == 0);
+    assert(icompare(str, "content-typf") < 0);
+    assert(icompare("content-typf", str) > 0);
+    assert(icompare(str, "content") > 0);
+
+    // views and strings
+    assert(iequals(str, "CONTENT-type"sv));
+    assert(iequals("CONTENT-type"sv, str));
+    assert(iequals(str, bizwen::string("content-TYPE")));
+    assert(icompare(str, "content-type-"sv) < 0);
+    assert(icompare("content-typd"sv, str) < 0);
+
+    // only ASCII letters are folded, '[' is not '{' and '@' is not '`'
+    assert(!iequals(bizwen::string("["), "{"));
+    assert(!iequals(bizwen::string("@"), "`"));
+
+    // long enough for the vectorized loop
+    bizwen::string const lower("abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz0123456789");
+    assert(iequals(lower, "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"));
+    assert(icompare(lower, "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ0123456788") > 0);
+
+    bizwen::u16string const u16(u"Accept");
+    assert(iequals(u16, u"ACCEPT"));
+    assert(icompare(u"accepts", u16) > 0);
+}
+} // namespace
+
+int main()
+{
+    test_case_conversion();
+    test_icompare();
+}
@@ -0,0 +1,53 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+// g++ -std=c++23 -I.. escape.cpp
+
+#include <cassert>
+
+#include "../escape.hpp"
+
+namespace
+{
+void test_json_unescape()
+{
+    bizwen::string str(R"(a\"b\\c\/d\b\f\n\r\t)");
+    assert(bizwen::json_unescape(str));
+    assert(str == "a\"b\\c/d\b\f\n\r\t");
+
+    str = R"(\u0041\u00e9\u20AC\ud83d\uDE00)";
+    assert(bizwen::json_unescape(str));
+    assert(str == "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+
+    bizwen::u16string u16(u"\\u0041\\ud83d\\ude00");
+    assert(bizwen::json_unescape(u16));
+    assert(u16 == u"A\U0001f600");
+
+    // a malformed \u in each of the 4 positions
+    for (auto const malformed : {R"(\uG000)", R"(\u0G00)", R"(\u00G0)", R"(\u000G)", R"(\u000 )", R"(\u00)"})
+    {
+        str = malformed;
+        assert(!bizwen::json_unescape(str));
+    }
+
+    // a malformed low surrogate in each of the 4 positions
+    for (auto const malformed :
+         {R"(\ud83d\uGe00)", R"(\ud83d\udG00)", R"(\ud83d\ude0G)", R"(\ud83d\ude G)", R"(\ud83d\u)"})
+    {
+        str = malformed;
+        assert(!bizwen::json_unescape(str));
+    }
+
+    for (auto const malformed : {R"(\)", R"(\x)", R"(\ude00)", R"(\ud83d)", R"(\ud83dx)"})
+    {
+        str = malformed;
+        assert(!bizwen::json_unescape(str));
+    }
+}
+} // namespace
+
+int main()
+{
+    test_json_unescape();
+}
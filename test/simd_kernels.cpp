@@ -0,0 +1,159 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+// compares the kernels of every level with the scalar kernels, build it without optimization and without -mavx2, so
+// the AVX2 kernels are dispatched and nothing is inlined except what the header forces:
+// g++ -std=c++23 -O0 -I.. simd_kernels.cpp
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "../basic_string.hpp"
+
+namespace
+{
+template <typename CharT>
+::std::vector<bizwen::detail::simd_kernels_<CharT> const *> levels()
+{
+    ::std::vector<bizwen::detail::simd_kernels_<CharT> const *> result;
+#if defined(BIZWEN_BASIC_STRING_SSE2)
+    result.push_back(&bizwen::detail::simd_kernels_of_<bizwen::detail::sse2_vec_<CharT>, CharT>);
+#endif
+#if defined(BIZWEN_BASIC_STRING_AVX2)
+#if defined(BIZWEN_BASIC_STRING_DISPATCH)
+    if (__builtin_cpu_supports("avx2"))
+#endif
+        result.push_back(&bizwen::detail::simd_kernels_of_<bizwen::detail::avx2_vec_<CharT>, CharT,
+                                                           bizwen::detail::avx2_entry_>);
+#endif
+
+    return result;
+}
+
+template <typename CharT>
+void test_kernels()
+{
+    auto const &scalar = bizwen::detail::simd_kernels_of_<void, CharT>;
+    ::std::mt19937 engine{};
+    // letters of both cases, whitespace, and characters which are not ASCII
+    CharT const alphabet[]{CharT('a'),  CharT('b'),  CharT('Z'),  CharT(' '),    CharT('\t'),
+                           CharT('\r'), CharT('\v'), CharT('@'),  CharT('['),    CharT(0x7f),
+                           CharT(0x80), CharT(0xff), CharT('\0'), CharT('\x1f'), CharT('`')};
+    ::std::uniform_int_distribution<::std::size_t> pick{0uz, ::std::size(alphabet) - 1uz};
+
+    for (auto const kernels : levels<CharT>())
+    {
+        for (auto size = 0uz; size != 100uz; ++size)
+        {
+            for (auto round = 0uz; round != 20uz; ++round)
+            {
+                ::std::vector<CharT> str(size);
+
+                // runs of few distinct characters, so every kernel finds matches in every lane
+                auto const kinds = round % 4uz + 1uz;
+
+                for (auto &ch : str)
+                    ch = alphabet[pick(engine) % (kinds * 3uz + 1uz)];
+
+                auto const first = str.data();
+                auto const last = first + size;
+
+                assert(kernels->ascii_prefix(first, last) == scalar.ascii_prefix(first, last));
+                assert(kernels->skip_space(first, last) == scalar.skip_space(first, last));
+                assert(kernels->skip_space_backward(first, last) == scalar.skip_space_backward(first, last));
+                assert(kernels->find_space(first, last) == scalar.find_space(first, last));
+
+                for (auto const ch : alphabet)
+                {
+                    assert(kernels->find_char(first, last, ch) == scalar.find_char(first, last, ch));
+                    assert(kernels->count_char(first, last, ch) == scalar.count_char(first, last, ch));
+                }
+
+                for (auto set_size = 0uz; set_size <= 17uz && set_size <= size; ++set_size)
+                {
+                    assert(kernels->find_first_of(first, last, first, set_size) ==
+                           scalar.find_first_of(first, last, first, set_size));
+                }
+
+                for (auto needle = 0uz; needle <= 5uz && needle <= size; ++needle)
+                {
+                    auto const pos = size / 2uz - needle / 2uz;
+
+                    assert(kernels->search(first, last, first + pos, needle) ==
+                           scalar.search(first, last, first + pos, needle));
+                }
+
+                auto replaced = str;
+                auto expected = str;
+                kernels->replace_char(replaced.data(), replaced.data() + size, CharT('a'), CharT(0xff));
+                scalar.replace_char(expected.data(), expected.data() + size, CharT('a'), CharT(0xff));
+                assert(replaced == expected);
+
+                for (auto const a : {CharT('A'), CharT('a')})
+                {
+                    auto converted = str;
+                    expected = str;
+                    kernels->ascii_case(converted.data(), converted.data() + size, a);
+                    scalar.ascii_case(expected.data(), expected.data() + size, a);
+                    assert(converted == expected);
+                }
+
+                // the vectorized loop stops at the tail or at the first block which differs, the rest is compared by
+                // the caller
+                auto other = str;
+                bizwen::detail::ascii_case_kernel_<void>(other.data(), other.data() + size, CharT('a'));
+
+                if (size != 0uz)
+                    other[engine() % size] = CharT('#');
+
+                auto mismatch = 0uz;
+
+                for (; mismatch != size; ++mismatch)
+                {
+                    auto const lower = [](CharT ch) {
+                        return ch >= CharT('A') && ch <= CharT('Z') ? static_cast<CharT>(ch | 0x20) : ch;
+                    };
+
+                    if (lower(str[mismatch]) != lower(other[mismatch]))
+                        break;
+                }
+
+                auto const index = kernels->ascii_mismatch_icase(first, other.data(), size);
+                assert(index <= mismatch && (index == mismatch || size - index < 32uz));
+            }
+        }
+    }
+}
+
+void test_string()
+{
+    bizwen::string str("abcdefghijklmnopqrstuvwxyzabcdefghijklmnop   ");
+    auto left = str;
+    left.trim_left();
+    assert(left == str);
+
+    auto both = str;
+    both.trim();
+    assert(both == "abcdefghijklmnopqrstuvwxyzabcdefghijklmnop");
+
+    bizwen::string spaces("   \t\t\r\n abcdefghijklmnopqrstuvwxyzabcdefghijklmnop");
+    spaces.trim_left();
+    assert(spaces == "abcdefghijklmnopqrstuvwxyzabcdefghijklmnop");
+
+    bizwen::string repeated(1000uz, 'x');
+    repeated[17uz] = 'y';
+    assert(repeated.count('x') == 999uz);
+    assert(repeated.count('y') == 1uz);
+}
+} // namespace
+
+int main()
+{
+    test_kernels<char>();
+    test_kernels<char16_t>();
+    test_kernels<char32_t>();
+    test_string();
+}
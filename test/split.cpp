@@ -0,0 +1,60 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+// g++ -std=c++23 -I.. split.cpp
+
+#include <cassert>
+#include <string_view>
+#include <vector>
+
+#include "../split.hpp"
+
+namespace
+{
+template <typename View>
+::std::vector<::std::string_view> fields(View view)
+{
+    ::std::vector<::std::string_view> result;
+
+    for (auto const field : view)
+        result.push_back(field);
+
+    return result;
+}
+
+using list = ::std::vector<::std::string_view>;
+using namespace ::std::string_view_literals;
+
+void test_split()
+{
+    assert(fields(bizwen::split("a,b,,c"sv, ',')) == (list{"a", "b", "", "c"}));
+    assert(fields(bizwen::split(""sv, ',')) == (list{""}));
+    assert(fields(bizwen::split(",a,"sv, ',', {.skip_empty = true})) == (list{"a"}));
+    assert(fields(bizwen::split("a::b::c"sv, "::"sv)) == (list{"a", "b", "c"}));
+    assert(fields(bizwen::split("a,b;c"sv, bizwen::any_of<char>(",;"))) == (list{"a", "b", "c"}));
+    assert(fields(bizwen::split("a,b,c"sv, ',', {.max_splits = 1})) == (list{"a", "b,c"}));
+    assert(fields(bizwen::split("a,b,c"sv, ',', {.max_splits = 0})) == (list{"a,b,c"}));
+
+    // skipped fields do not count towards max_splits
+    assert(fields(bizwen::split(",,a,b,c"sv, ',', {.skip_empty = true, .max_splits = 1})) == (list{"a", "b,c"}));
+    assert(fields(bizwen::split("a,,,b,c"sv, ',', {.skip_empty = true, .max_splits = 2})) == (list{"a", "b", "c"}));
+    assert(fields(bizwen::split(",,a,,"sv, ',', {.skip_empty = true, .max_splits = 1})) == (list{"a", ","}));
+    assert(fields(bizwen::split("::a::::b::c"sv, "::"sv, {.skip_empty = true, .max_splits = 1})) ==
+           (list{"a", "::b::c"}));
+}
+
+void test_join()
+{
+    list const strs{"a", "b", "c"};
+    assert(bizwen::join(strs, ", ") == "a, b, c");
+    assert(bizwen::join(strs, '-') == "a-b-c");
+    assert(bizwen::join(list{}, ',').empty());
+}
+} // namespace
+
+int main()
+{
+    test_split();
+    test_join();
+}
@@ -0,0 +1,778 @@
+// Copyright 2023-2025 YexuanXiao
+// Distributed under the MIT License.
+// https://github.com/YexuanXiao/basic_string
+
+#if !defined(BIZWEN_UNICODE_HPP)
+#define BIZWEN_UNICODE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "basic_string.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+namespace bizwen
+{
+/**
+ * @brief thrown when the input of transcoding is not well-formed UTF-8/UTF-16/UTF-32
+ */
+class transcode_error : public ::std::range_error
+{
+    ::std::size_t position_{};
+
+  public:
+    explicit transcode_error(::std::size_t position)
+        : ::std::range_error("invalid code unit sequence, please check position()."), position_(position)
+    {
+    }
+
+    /**
+     * @return index of the first code unit of the invalid sequence in the input
+     */
+    ::std::size_t position() const noexcept
+    {
+        return position_;
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief char and char8_t are UTF-8, wchar_t is UTF-16 or UTF-32 depending on its size
+ */
+template <typename CharT>
+inline constexpr ::std::size_t utf_width_{sizeof(CharT)};
+
+/**
+ * @brief code point and length of a decoded sequence, a length of zero means the sequence is invalid
+ */
+struct decoded_
+{
+    char32_t code_point;
+    ::std::size_t length;
+};
+
+template <typename CharT>
+constexpr decoded_ decode_utf_(CharT const *first, CharT const *last) noexcept
+{
+    if constexpr (utf_width_<CharT> == 1uz)
+    {
+        auto const unit = [&](::std::size_t i) { return static_cast<char32_t>(static_cast<unsigned char>(first[i])); };
+        auto const cont = [&](::std::size_t i, char32_t lo, char32_t hi) {
+            return static_cast<::std::size_t>(last - first) > i && unit(i) >= lo && unit(i) <= hi;
+        };
+        auto const lead = unit(0uz);
+
+        if (lead < 0x80u)
+            return {lead, 1uz};
+
+        if (lead >= 0xc2u && lead <= 0xdfu)
+        {
+            if (cont(1uz, 0x80u, 0xbfu))
+                return {(lead & 0x1fu) << 6 | (unit(1uz) & 0x3fu), 2uz};
+        }
+        else if (lead >= 0xe0u && lead <= 0xefu)
+        {
+            // exclude overlong sequences and surrogates
+            auto const lo = lead == 0xe0u ? 0xa0u : 0x80u;
+            auto const hi = lead == 0xedu ? 0x9fu : 0xbfu;
+
+            if (cont(1uz, lo, hi) && cont(2uz, 0x80u, 0xbfu))
+                return {(lead & 0x0fu) << 12 | (unit(1uz) & 0x3fu) << 6 | (unit(2uz) & 0x3fu), 3uz};
+        }
+        else if (lead >= 0xf0u && lead <= 0xf4u)
+        {
+            // exclude overlong sequences and code points greater than U+10FFFF
+            auto const lo = lead == 0xf0u ? 0x90u : 0x80u;
+            auto const hi = lead == 0xf4u ? 0x8fu : 0xbfu;
+
+            if (cont(1uz, lo, hi) && cont(2uz, 0x80u, 0xbfu) && cont(3uz, 0x80u, 0xbfu))
+                return {(lead & 0x07u) << 18 | (unit(1uz) & 0x3fu) << 12 | (unit(2uz) & 0x3fu) << 6 |
+                            (unit(3uz) & 0x3fu),
+                        4uz};
+        }
+
+        return {0u, 0uz};
+    }
+    else if constexpr (utf_width_<CharT> == 2uz)
+    {
+        auto const lead = static_cast<char32_t>(static_cast<char16_t>(*first));
+
+        if (lead < 0xd800u || lead > 0xdfffu)
+            return {lead, 1uz};
+
+        if (lead <= 0xdbffu && last - first > 1)
+        {
+            auto const trail = static_cast<char32_t>(static_cast<char16_t>(first[1]));
+
+            if (trail >= 0xdc00u && trail <= 0xdfffu)
+                return {0x10000u + ((lead - 0xd800u) << 10) + (trail - 0xdc00u), 2uz};
+        }
+
+        return {0u, 0uz};
+    }
+    else
+    {
+        auto const code_point = static_cast<char32_t>(*first);
+
+        if (code_point > 0x10ffffu || (code_point >= 0xd800u && code_point <= 0xdfffu))
+            return {0u, 0uz};
+
+        return {code_point, 1uz};
+    }
+}
+
+/**
+ * @brief the code point must be valid
+ * @return the next position of the last written code unit
+ */
+template <typename CharT>
+constexpr CharT *encode_utf_(char32_t code_point, CharT *out) noexcept
+{
+    if constexpr (utf_width_<CharT> == 1uz)
+    {
+        if (code_point < 0x80u)
+        {
+            *out++ = static_cast<CharT>(code_point);
+        }
+        else if (code_point < 0x800u)
+        {
+            *out++ = static_cast<CharT>(0xc0u | code_point >> 6);
+            *out++ = static_cast<CharT>(0x80u | (code_point & 0x3fu));
+        }
+        else if (code_point < 0x10000u)
+        {
+            *out++ = static_cast<CharT>(0xe0u | code_point >> 12);
+            *out++ = static_cast<CharT>(0x80u | (code_point >> 6 & 0x3fu));
+            *out++ = static_cast<CharT>(0x80u | (code_point & 0x3fu));
+        }
+        else
+        {
+            *out++ = static_cast<CharT>(0xf0u | code_point >> 18);
+            *out++ = static_cast<CharT>(0x80u | (code_point >> 12 & 0x3fu));
+            *out++ = static_cast<CharT>(0x80u | (code_point >> 6 & 0x3fu));
+            *out++ = static_cast<CharT>(0x80u | (code_point & 0x3fu));
+        }
+    }
+    else if constexpr (utf_width_<CharT> == 2uz)
+    {
+        if (code_point < 0x10000u)
+        {
+            *out++ = static_cast<CharT>(code_point);
+        }
+        else
+        {
+            *out++ = static_cast<CharT>(0xd800u + ((code_point - 0x10000u) >> 10));
+            *out++ = static_cast<CharT>(0xdc00u + ((code_point - 0x10000u) & 0x3ffu));
+        }
+    }
+    else
+    {
+        *out++ = static_cast<CharT>(code_point);
+    }
+
+    return out;
+}
+
+/**
+ * @return number of To for each From in the worst case
+ */
+template <typename To, typename From>
+inline constexpr ::std::size_t max_expansion_{utf_width_<To> >= utf_width_<From> ? 1uz
+                                              : utf_width_<To> == 2uz           ? 2uz
+                                              : utf_width_<From> == 2uz         ? 3uz
+                                                                                : 4uz};
+
+/**
+ * @return a pointer to the first character that is not ASCII, or last
+ */
+template <typename CharT>
+constexpr CharT const *ascii_run_(CharT const *first, CharT const *last) noexcept
+{
+    if !consteval
+    {
+        return detail::ascii_prefix_(first, last);
+    }
+
+    for (; first != last && static_cast<::std::make_unsigned_t<CharT>>(*first) < 0x80u; ++first)
+        ;
+
+    return first;
+}
+
+/**
+ * @brief validates [first, last) and counts the code units after transcoding
+ * @return the count, or npos with error set to the invalid sequence
+ */
+template <typename To, typename From>
+constexpr ::std::size_t transcoded_size_(From const *first, From const *last, From const *&error) noexcept
+{
+    auto size = 0uz;
+
+    while (first != last)
+    {
+        auto const ascii_last = detail::ascii_run_(first, last);
+        size += static_cast<::std::size_t>(ascii_last - first);
+
+        if ((first = ascii_last) == last)
+            break;
+
+        auto const [code_point, length] = detail::decode_utf_(first, last);
+
+        if (length == 0uz)
+        {
+            error = first;
+
+            return ::std::size_t(-1);
+        }
+
+        first += length;
+
+        if constexpr (utf_width_<To> == 1uz)
+            size += code_point < 0x800u ? 2uz : code_point < 0x10000u ? 3uz : 4uz;
+        else if constexpr (utf_width_<To> == 2uz)
+            size += code_point < 0x10000u ? 1uz : 2uz;
+        else
+            ++size;
+    }
+
+    return size;
+}
+
+template <typename To, typename From>
+constexpr basic_string<To> transcode_(From const *first, From const *last)
+{
+    auto const begin = first;
+    From const *error{};
+    basic_string<To> str;
+    auto size = static_cast<::std::size_t>(last - first);
+
+    // output may be larger than input, count it first so that the string is sized exactly
+    if constexpr (max_expansion_<To, From> != 1uz)
+    {
+        size = detail::transcoded_size_<To>(first, last, error);
+
+        if (error)
+            throw transcode_error(static_cast<::std::size_t>(error - begin));
+    }
+
+    str.resize_and_overwrite(size, [&](To *out, ::std::size_t) {
+        auto const out_begin = out;
+
+        while (first != last)
+        {
+            auto const ascii_last = detail::ascii_run_(first, last);
+            out = ::std::ranges::transform(first, ascii_last, out, [](From ch) { return static_cast<To>(ch); }).out;
+
+            if ((first = ascii_last) == last)
+                break;
+
+            auto const [code_point, length] = detail::decode_utf_(first, last);
+
+            if (length == 0uz)
+            {
+                error = first;
+
+                break;
+            }
+
+            first += length;
+            out = detail::encode_utf_(code_point, out);
+        }
+
+        return static_cast<::std::size_t>(out - out_begin);
+    });
+
+    if (error)
+        throw transcode_error(static_cast<::std::size_t>(error - begin));
+
+    return str;
+}
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+// UTF-8 validation with lookup tables, described by John Keiser and Daniel Lemire in
+// "Validating UTF-8 In Less Than One Instruction Per Byte". Each byte is classified by the high and low
+// nibbles of the previous byte and the high nibble of itself, the three classes must not share a bit.
+
+inline constexpr unsigned char too_short_{1u << 0};
+inline constexpr unsigned char too_long_{1u << 1};
+inline constexpr unsigned char overlong_3_{1u << 2};
+inline constexpr unsigned char too_large_{1u << 3};
+inline constexpr unsigned char surrogate_{1u << 4};
+inline constexpr unsigned char overlong_2_{1u << 5};
+inline constexpr unsigned char too_large_1000_{1u << 6};
+inline constexpr unsigned char overlong_4_{1u << 6};
+inline constexpr unsigned char two_conts_{1u << 7};
+inline constexpr unsigned char carry_{too_short_ | too_long_ | two_conts_};
+
+inline constexpr ::std::array<unsigned char, 16uz> byte_1_high_{
+    // 0_______ ________
+    too_long_, too_long_, too_long_, too_long_, too_long_, too_long_, too_long_, too_long_,
+    // 10______ ________
+    two_conts_, two_conts_, two_conts_, two_conts_,
+    // 1100____ ________
+    too_short_ | overlong_2_,
+    // 1101____ ________
+    too_short_,
+    // 1110____ ________
+    too_short_ | overlong_3_ | surrogate_,
+    // 1111____ ________
+    too_short_ | too_large_ | too_large_1000_ | overlong_4_};
+
+inline constexpr ::std::array<unsigned char, 16uz> byte_1_low_{
+    // ____0000 ________
+    carry_ | overlong_3_ | overlong_2_ | overlong_4_,
+    // ____0001 ________
+    carry_ | overlong_2_,
+    // ____001_ ________
+    carry_, carry_,
+    // ____0100 ________
+    carry_ | too_large_,
+    // ____0101 ________
+    carry_ | too_large_ | too_large_1000_,
+    // ____011_ ________
+    carry_ | too_large_ | too_large_1000_, carry_ | too_large_ | too_large_1000_,
+    // ____1___ ________
+    carry_ | too_large_ | too_large_1000_, carry_ | too_large_ | too_large_1000_, carry_ | too_large_ | too_large_1000_,
+    carry_ | too_large_ | too_large_1000_, carry_ | too_large_ | too_large_1000_,
+    // ____1101 ________
+    carry_ | too_large_ | too_large_1000_ | surrogate_, carry_ | too_large_ | too_large_1000_,
+    carry_ | too_large_ | too_large_1000_};
+
+inline constexpr ::std::array<unsigned char, 16uz> byte_2_high_{
+    // ________ 0_______
+    too_short_, too_short_, too_short_, too_short_, too_short_, too_short_, too_short_, too_short_,
+    // ________ 1000____
+    too_long_ | overlong_2_ | two_conts_ | overlong_3_ | too_large_1000_ | overlong_4_,
+    // ________ 1001____
+    too_long_ | overlong_2_ | two_conts_ | overlong_3_ | too_large_,
+    // ________ 101_____
+    too_long_ | overlong_2_ | two_conts_ | surrogate_ | too_large_,
+    too_long_ | overlong_2_ | two_conts_ | surrogate_ | too_large_,
+    // ________ 11______
+    too_short_, too_short_, too_short_, too_short_};
+
+#if defined(__AVX2__)
+struct utf8_block_
+{
+    using reg = __m256i;
+
+    static inline constexpr ::std::size_t size{32uz};
+
+    static reg load(unsigned char const *p) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+    }
+
+    static reg table(::std::array<unsigned char, 16uz> const &t) noexcept
+    {
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(t.data())));
+    }
+
+    static reg broadcast(unsigned char ch) noexcept
+    {
+        return _mm256_set1_epi8(static_cast<char>(ch));
+    }
+
+    static reg lookup(reg table, reg index) noexcept
+    {
+        return _mm256_shuffle_epi8(table, index);
+    }
+
+    static reg high_nibble(reg v) noexcept
+    {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), broadcast(0x0fu));
+    }
+
+    static reg low_nibble(reg v) noexcept
+    {
+        return _mm256_and_si256(v, broadcast(0x0fu));
+    }
+
+    /**
+     * @return v shifted by N bytes, filled with the last bytes of prev
+     */
+    template <int N>
+    static reg prev(reg v, reg prev) noexcept
+    {
+        return _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21), 16 - N);
+    }
+
+    static reg subs(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_subs_epu8(lhs, rhs);
+    }
+
+    static reg bit_and(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_and_si256(lhs, rhs);
+    }
+
+    static reg bit_or(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_or_si256(lhs, rhs);
+    }
+
+    static reg bit_xor(reg lhs, reg rhs) noexcept
+    {
+        return _mm256_xor_si256(lhs, rhs);
+    }
+
+    static bool is_ascii(reg v) noexcept
+    {
+        return _mm256_movemask_epi8(v) == 0;
+    }
+
+    static bool is_zero(reg v) noexcept
+    {
+        return _mm256_testz_si256(v, v) != 0;
+    }
+
+    /**
+     * @brief non-zero if the last 3 bytes start a sequence that is not finished
+     */
+    static reg incomplete(reg v) noexcept
+    {
+        return _mm256_subs_epu8(v, _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     static_cast<char>(0xf0u - 1u), static_cast<char>(0xe0u - 1u),
+                                                     static_cast<char>(0xc0u - 1u)));
+    }
+};
+#else
+struct utf8_block_
+{
+    using reg = __m128i;
+
+    static inline constexpr ::std::size_t size{16uz};
+
+    static reg load(unsigned char const *p) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+    }
+
+    static reg table(::std::array<unsigned char, 16uz> const &t) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<__m128i const *>(t.data()));
+    }
+
+    static reg broadcast(unsigned char ch) noexcept
+    {
+        return _mm_set1_epi8(static_cast<char>(ch));
+    }
+
+    static reg lookup(reg table, reg index) noexcept
+    {
+        return _mm_shuffle_epi8(table, index);
+    }
+
+    static reg high_nibble(reg v) noexcept
+    {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), broadcast(0x0fu));
+    }
+
+    static reg low_nibble(reg v) noexcept
+    {
+        return _mm_and_si128(v, broadcast(0x0fu));
+    }
+
+    template <int N>
+    static reg prev(reg v, reg prev) noexcept
+    {
+        return _mm_alignr_epi8(v, prev, 16 - N);
+    }
+
+    static reg subs(reg lhs, reg rhs) noexcept
+    {
+        return _mm_subs_epu8(lhs, rhs);
+    }
+
+    static reg bit_and(reg lhs, reg rhs) noexcept
+    {
+        return _mm_and_si128(lhs, rhs);
+    }
+
+    static reg bit_or(reg lhs, reg rhs) noexcept
+    {
+        return _mm_or_si128(lhs, rhs);
+    }
+
+    static reg bit_xor(reg lhs, reg rhs) noexcept
+    {
+        return _mm_xor_si128(lhs, rhs);
+    }
+
+    static bool is_ascii(reg v) noexcept
+    {
+        return _mm_movemask_epi8(v) == 0;
+    }
+
+    static bool is_zero(reg v) noexcept
+    {
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) == 0xffff;
+    }
+
+    static reg incomplete(reg v) noexcept
+    {
+        return _mm_subs_epu8(v, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              static_cast<char>(0xf0u - 1u), static_cast<char>(0xe0u - 1u),
+                                              static_cast<char>(0xc0u - 1u)));
+    }
+};
+#endif
+
+/**
+ * @brief validates whole blocks, the sequence that may be cut by the last block is left to the caller
+ * @return the position to continue with scalar validation, or nullptr if the input is invalid
+ */
+inline unsigned char const *validate_utf8_blocks_(unsigned char const *first, unsigned char const *last) noexcept
+{
+    using block = utf8_block_;
+
+    auto const begin = first;
+    auto const table_1_high = block::table(byte_1_high_);
+    auto const table_1_low = block::table(byte_1_low_);
+    auto const table_2_high = block::table(byte_2_high_);
+    auto const zero = block::broadcast(0u);
+    auto error = zero;
+    auto prev_input = zero;
+    auto prev_incomplete = zero;
+
+    for (; static_cast<::std::size_t>(last - first) >= block::size; first += block::size)
+    {
+        auto const input = block::load(first);
+
+        if (block::is_ascii(input))
+        {
+            // the previous block must end with a complete sequence
+            error = block::bit_or(error, prev_incomplete);
+
+            continue;
+        }
+
+        auto const prev1 = block::prev<1>(input, prev_input);
+        auto const special_cases =
+            block::bit_and(block::bit_and(block::lookup(table_1_high, block::high_nibble(prev1)),
+                                          block::lookup(table_1_low, block::low_nibble(prev1))),
+                           block::lookup(table_2_high, block::high_nibble(input)));
+        // only 111_____ and 1111____ will be greater than 0x80
+        auto const must_be_2_3_continuation =
+            block::bit_or(block::subs(block::prev<2>(input, prev_input), block::broadcast(0xe0u - 0x80u)),
+                          block::subs(block::prev<3>(input, prev_input), block::broadcast(0xf0u - 0x80u)));
+        error = block::bit_or(error, block::bit_xor(block::bit_and(must_be_2_3_continuation, block::broadcast(0x80u)),
+                                                    special_cases));
+        prev_incomplete = block::incomplete(input);
+        prev_input = input;
+    }
+
+    if (!block::is_zero(error))
+        return nullptr;
+
+    // back to the lead byte of the last sequence, which may continue after the blocks
+    auto const stop = first - ::std::ranges::min(static_cast<::std::size_t>(first - begin), 3uz);
+
+    for (auto p = first; p != stop;)
+    {
+        if (*--p >= 0xc0u)
+            return p;
+        else if (*p < 0x80u)
+            break;
+    }
+
+    return first;
+}
+#endif
+
+/**
+ * @return number of code units that are not 10xxxxxx
+ */
+template <typename CharT>
+constexpr ::std::size_t count_leading_units_(CharT const *first, CharT const *last) noexcept
+{
+    auto count = 0uz;
+
+    if !consteval
+    {
+#if defined(BIZWEN_BASIC_STRING_SIMD)
+        using vec = simd_vec_<CharT>;
+        auto const cont_min = vec::broadcast(static_cast<CharT>(0x7fu));
+        auto const cont_max = vec::broadcast(static_cast<CharT>(0xc0u));
+
+        for (; static_cast<::std::size_t>(last - first) >= vec::size; first += vec::size)
+        {
+            auto const v = vec::load(first);
+            auto const mask = ((v > cont_min) & (v < cont_max)).mask();
+            count += vec::size - static_cast<::std::size_t>(::std::popcount(mask));
+        }
+#endif
+    }
+
+    for (; first != last; ++first)
+        count += (static_cast<unsigned char>(*first) & 0xc0u) != 0x80u;
+
+    return count;
+}
+
+template <typename CharT>
+constexpr bool is_valid_utf8_(CharT const *first, CharT const *last) noexcept
+{
+    if !consteval
+    {
+#if defined(__AVX2__) || defined(__SSSE3__)
+        auto const p = detail::validate_utf8_blocks_(reinterpret_cast<unsigned char const *>(first),
+                                                     reinterpret_cast<unsigned char const *>(last));
+
+        if (!p)
+            return false;
+
+        first += p - reinterpret_cast<unsigned char const *>(first);
+#endif
+    }
+
+    while (first != last)
+    {
+        if ((first = detail::ascii_run_(first, last)) == last)
+            break;
+
+        auto const length = detail::decode_utf_(first, last).length;
+
+        if (length == 0uz)
+            return false;
+
+        first += length;
+    }
+
+    return true;
+}
+} // namespace detail
+
+// ********************************* begin transcoding ******************************
+
+// char and char8_t are treated as UTF-8, wchar_t as UTF-16 on Windows and UTF-32 on other platforms.
+// Every function throws transcode_error with the position of the first invalid sequence.
+
+constexpr u8string to_u8(::std::u16string_view sv)
+{
+    return detail::transcode_<char8_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u8string to_u8(::std::u32string_view sv)
+{
+    return detail::transcode_<char8_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u8string to_u8(::std::wstring_view sv)
+{
+    return detail::transcode_<char8_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u16string to_u16(::std::string_view sv)
+{
+    return detail::transcode_<char16_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u16string to_u16(::std::u8string_view sv)
+{
+    return detail::transcode_<char16_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u16string to_u16(::std::u32string_view sv)
+{
+    return detail::transcode_<char16_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u16string to_u16(::std::wstring_view sv)
+{
+    return detail::transcode_<char16_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u32string to_u32(::std::string_view sv)
+{
+    return detail::transcode_<char32_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u32string to_u32(::std::u8string_view sv)
+{
+    return detail::transcode_<char32_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u32string to_u32(::std::u16string_view sv)
+{
+    return detail::transcode_<char32_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr u32string to_u32(::std::wstring_view sv)
+{
+    return detail::transcode_<char32_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr wstring to_wstring(::std::string_view sv)
+{
+    return detail::transcode_<wchar_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr wstring to_wstring(::std::u8string_view sv)
+{
+    return detail::transcode_<wchar_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr wstring to_wstring(::std::u16string_view sv)
+{
+    return detail::transcode_<wchar_t>(sv.data(), sv.data() + sv.size());
+}
+
+constexpr wstring to_wstring(::std::u32string_view sv)
+{
+    return detail::transcode_<wchar_t>(sv.data(), sv.data() + sv.size());
+}
+
+// ********************************* begin validation ******************************
+
+constexpr bool is_ascii(::std::string_view sv) noexcept
+{
+    return detail::ascii_run_(sv.data(), sv.data() + sv.size()) == sv.data() + sv.size();
+}
+
+constexpr bool is_ascii(::std::u8string_view sv) noexcept
+{
+    return detail::ascii_run_(sv.data(), sv.data() + sv.size()) == sv.data() + sv.size();
+}
+
+/**
+ * @brief rejects overlong sequences, surrogates and code points greater than U+10FFFF
+ */
+constexpr bool is_valid_utf8(::std::string_view sv) noexcept
+{
+    return detail::is_valid_utf8_(sv.data(), sv.data() + sv.size());
+}
+
+constexpr bool is_valid_utf8(::std::u8string_view sv) noexcept
+{
+    return detail::is_valid_utf8_(sv.data(), sv.data() + sv.size());
+}
+
+/**
+ * @brief counts the bytes that are not continuation bytes, which is exact for valid UTF-8
+ */
+constexpr ::std::size_t code_point_count(::std::string_view sv) noexcept
+{
+    return detail::count_leading_units_(sv.data(), sv.data() + sv.size());
+}
+
+constexpr ::std::size_t code_point_count(::std::u8string_view sv) noexcept
+{
+    return detail::count_leading_units_(sv.data(), sv.data() + sv.size());
+}
+} // namespace bizwen
+
+#endif